@@ -0,0 +1,281 @@
+#!/usr/bin/env python3
+"""벤치마크 로그의 기준값(baseline) 저장 및 회귀 비교 도구
+
+Lab3 실험 드라이버(rocksdb_benchmark / rocksdb_read_benchmark / rocksdb_shard_benchmark)
+로그에서 처리량, 꼬리 지연 시간, WAF, 공간 증폭을 추출해 설정 이름별로 저장하고,
+새 실행 결과를 저장된 기준값과 부트스트랩 신뢰구간으로 비교한다.
+
+사용 예:
+    # 기준값 저장 (반복 실행 로그 여러 개)
+    python3 bench_compare.py record --store baseline.json --config hot_LZ4_cold_ZSTD \\
+        exp_log/read_hot_LZ4_cold_ZSTD_run*.log
+
+    # 새 실행을 기준값과 비교 (회귀가 있으면 종료 코드 1)
+    python3 bench_compare.py compare --store baseline.json --config hot_LZ4_cold_ZSTD \\
+        new_log/read_hot_LZ4_cold_ZSTD_run*.log
+
+    # 저장된 설정 목록
+    python3 bench_compare.py list --store baseline.json
+"""
+
+import argparse
+import datetime
+import json
+import os
+import platform
+import random
+import re
+import subprocess
+import sys
+
+# 지표 이름 -> (로그 정규식, 값이 클수록 좋은지)
+NUMBER = r"([0-9.eE+-]+)"
+METRICS = {
+    "duration_sec": (r"총 소요시간: " + NUMBER + r"초", False),
+    "stable_ops_per_sec": (r"안정 구간 처리량: " + NUMBER + r" ops/s", True),
+    "stable_p50_us": (r"안정 구간 지연 시간\(us\) - .*p50: " + NUMBER, False),
+    "stable_p99_us": (r"안정 구간 지연 시간\(us\) - .*p99: " + NUMBER, False),
+    "write_ops_per_sec": (r"쓰기 소요시간: .*처리량: " + NUMBER + r" ops/s", True),
+    "read_ops_per_sec": (r"읽기 소요시간: .*처리량: " + NUMBER + r" ops/s", True),
+    "waf": (r"^WAF: " + NUMBER, False),
+    "space_amp": (r"^공간 증폭: " + NUMBER, False),
+}
+
+# steady state 판정 결과 (SteadyStateDetector::Report 출력)
+# 미도달 실행의 "안정 구간" 지표는 전체 측정 구간 기준이라 안정 구간 기준값과 비교할 수 없다
+STEADY_REACHED = r"^steady state 도달"
+STEADY_NOT_REACHED = r"^steady state 미도달"
+STABLE_PREFIX = "stable_"
+
+# 로그에 기록된 환경 정보 (드라이버의 printBuildInfo / printCpuTopology 출력)
+FINGERPRINT_PATTERNS = {
+    "rocksdb_version": r"^RocksDB 버전: (.+)$",
+    "compiler": r"^컴파일러: (.+)$",
+    "git_commit": r"^빌드 커밋: (.+)$",
+    "kernel": r"^커널: (.+)$",
+    "machine": r"^아키텍처: (.+)$",
+    "cpu_model": r"^CPU 모델: (.+)$",
+    "logical_cores": r"^논리 코어 수: (\d+)$",
+}
+
+
+def parse_log(path):
+    """로그 파일 하나에서 지표와 환경 정보를 추출"""
+    with open(path, encoding="utf-8", errors="replace") as f:
+        text = f.read()
+
+    metrics = {}
+    for name, (pattern, _) in METRICS.items():
+        match = re.search(pattern, text, re.MULTILINE)
+        if match:
+            metrics[name] = float(match.group(1))
+
+    # 미도달 실행은 stable_* 지표를 버리고 판정 결과만 남긴다
+    steady = None
+    if re.search(STEADY_NOT_REACHED, text, re.MULTILINE):
+        steady = False
+        metrics = {k: v for k, v in metrics.items() if not k.startswith(STABLE_PREFIX)}
+    elif re.search(STEADY_REACHED, text, re.MULTILINE):
+        steady = True
+
+    fingerprint = {}
+    for name, pattern in FINGERPRINT_PATTERNS.items():
+        match = re.search(pattern, text, re.MULTILINE)
+        if match:
+            fingerprint[name] = match.group(1).strip()
+    return metrics, steady, fingerprint
+
+
+# 이 도구를 실행한 환경 (벤치마크 실행 환경과 다를 수 있으므로 비교 대상에서 제외)
+RECORDER_PREFIX = "recorder_"
+
+
+def recorder_fingerprint():
+    """record/compare를 실행한 호스트와 작업 디렉토리 정보"""
+    info = {
+        RECORDER_PREFIX + "kernel": platform.release(),
+        RECORDER_PREFIX + "machine": platform.machine(),
+    }
+    try:
+        commit = subprocess.run(["git", "rev-parse", "--short", "HEAD"],
+                                capture_output=True, text=True, check=True).stdout.strip()
+        info[RECORDER_PREFIX + "git_commit"] = commit
+    except (OSError, subprocess.CalledProcessError):
+        pass
+    return info
+
+
+def collect_runs(log_paths):
+    runs, fingerprint = [], {}
+    for path in log_paths:
+        metrics, steady, fp = parse_log(path)
+        if not metrics:
+            print(f"경고: 지표를 찾지 못한 로그 - {path}", file=sys.stderr)
+            continue
+        if steady is False:
+            print(f"경고: steady state 미도달 - stable_* 지표 제외: {path}", file=sys.stderr)
+        if steady is not None:
+            metrics["steady_state"] = steady
+        runs.append(metrics)
+        fingerprint.update(fp)
+    fingerprint.update(recorder_fingerprint())
+    return runs, fingerprint
+
+
+def load_store(path):
+    if not os.path.exists(path):
+        return {"configs": {}}
+    with open(path, encoding="utf-8") as f:
+        return json.load(f)
+
+
+def save_store(path, store):
+    with open(path, "w", encoding="utf-8") as f:
+        json.dump(store, f, ensure_ascii=False, indent=2)
+
+
+def mean(values):
+    return sum(values) / len(values)
+
+
+def bootstrap_relative_change(base, new, resamples, alpha, rng):
+    """(new 평균 - base 평균) / base 평균 의 부트스트랩 신뢰구간"""
+    base_mean = mean(base)
+    if base_mean == 0:
+        return None
+    point = (mean(new) - base_mean) / base_mean
+
+    changes = []
+    for _ in range(resamples):
+        b = mean([rng.choice(base) for _ in base])
+        n = mean([rng.choice(new) for _ in new])
+        if b != 0:
+            changes.append((n - b) / b)
+    changes.sort()
+    low = changes[int(len(changes) * alpha / 2)]
+    high = changes[min(len(changes) - 1, int(len(changes) * (1 - alpha / 2)))]
+    return point, low, high
+
+
+def cmd_record(args):
+    runs, fingerprint = collect_runs(args.logs)
+    if not runs:
+        print("저장할 결과가 없습니다.", file=sys.stderr)
+        return 1
+
+    store = load_store(args.store)
+    entry = store["configs"].get(args.config)
+    if entry and args.append:
+        entry["runs"].extend(runs)
+        entry["fingerprint"].update(fingerprint)
+    else:
+        entry = {"fingerprint": fingerprint, "runs": runs}
+    entry["recorded_at"] = datetime.datetime.now().isoformat(timespec="seconds")
+    store["configs"][args.config] = entry
+    save_store(args.store, store)
+
+    print(f"기준값 저장: {args.config} ({len(entry['runs'])}회 실행) -> {args.store}")
+    return 0
+
+
+def cmd_compare(args):
+    store = load_store(args.store)
+    entry = store["configs"].get(args.config)
+    if entry is None:
+        print(f"저장된 기준값이 없습니다: {args.config}", file=sys.stderr)
+        return 2
+
+    runs, fingerprint = collect_runs(args.logs)
+    if not runs:
+        print("비교할 결과가 없습니다.", file=sys.stderr)
+        return 2
+
+    # 환경이 다르면 결과 해석에 주의하도록 표시
+    for key, base_value in entry["fingerprint"].items():
+        if key.startswith(RECORDER_PREFIX):
+            continue
+        new_value = fingerprint.get(key)
+        if new_value is not None and new_value != base_value:
+            print(f"환경 차이 - {key}: 기준 {base_value} / 현재 {new_value}")
+
+    # steady state 미도달 실행 수 (이 실행들의 stable_* 지표는 비교에서 빠짐)
+    base_unsteady = sum(1 for r in entry["runs"] if r.get("steady_state") is False)
+    new_unsteady = sum(1 for r in runs if r.get("steady_state") is False)
+    if base_unsteady or new_unsteady:
+        print(f"steady state 미도달 실행 - 기준 {base_unsteady}회, 현재 {new_unsteady}회 (stable_* 지표에서 제외)")
+
+    rng = random.Random(args.seed)
+    regressions = 0
+    print(f"\n설정: {args.config} (기준 {len(entry['runs'])}회, 현재 {len(runs)}회, "
+          f"{int((1 - args.alpha) * 100)}% 신뢰구간)")
+    print(f"{'지표':<20}{'기준 평균':>14}{'현재 평균':>14}{'변화율':>10}{'신뢰구간':>22}  판정")
+
+    for name, (_, higher_is_better) in METRICS.items():
+        base = [r[name] for r in entry["runs"] if name in r]
+        new = [r[name] for r in runs if name in r]
+        if not base or not new:
+            continue
+        result = bootstrap_relative_change(base, new, args.resamples, args.alpha, rng)
+        if result is None:
+            continue
+        point, low, high = result
+
+        # 신뢰구간이 0을 포함하지 않고 변화 폭이 임계값 이상이면 유의미한 변화
+        worse = (high < 0) if higher_is_better else (low > 0)
+        better = (low > 0) if higher_is_better else (high < 0)
+        if worse and abs(point) >= args.threshold:
+            verdict = "회귀 ❌"
+            regressions += 1
+        elif better and abs(point) >= args.threshold:
+            verdict = "개선"
+        else:
+            verdict = "유의차 없음"
+
+        ci = f"[{low * 100:+.1f}%, {high * 100:+.1f}%]"
+        print(f"{name:<20}{mean(base):>14.4g}{mean(new):>14.4g}{point * 100:>+9.1f}%{ci:>22}  {verdict}")
+
+    print(f"\n회귀 지표 수: {regressions}")
+    return 1 if regressions > 0 else 0
+
+
+def cmd_list(args):
+    store = load_store(args.store)
+    for name, entry in sorted(store["configs"].items()):
+        fp = entry["fingerprint"]
+        print(f"{name}: {len(entry['runs'])}회, 저장 {entry.get('recorded_at', '-')}, "
+              f"RocksDB {fp.get('rocksdb_version', '?')}, 커밋 {fp.get('git_commit', '?')}")
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="RocksDB 벤치마크 기준값 저장 및 회귀 비교")
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    record = sub.add_parser("record", help="로그를 기준값으로 저장")
+    record.add_argument("--store", required=True, help="기준값 JSON 파일")
+    record.add_argument("--config", required=True, help="설정 이름")
+    record.add_argument("--append", action="store_true", help="기존 실행 결과에 추가")
+    record.add_argument("logs", nargs="+")
+    record.set_defaults(func=cmd_record)
+
+    compare = sub.add_parser("compare", help="로그를 기준값과 비교")
+    compare.add_argument("--store", required=True, help="기준값 JSON 파일")
+    compare.add_argument("--config", required=True, help="설정 이름")
+    compare.add_argument("--alpha", type=float, default=0.05, help="유의수준 (기본 0.05)")
+    compare.add_argument("--threshold", type=float, default=0.03,
+                         help="회귀로 판정할 최소 변화율 (기본 0.03 = 3%%)")
+    compare.add_argument("--resamples", type=int, default=10000, help="부트스트랩 반복 횟수")
+    compare.add_argument("--seed", type=int, default=42, help="부트스트랩 시드")
+    compare.add_argument("logs", nargs="+")
+    compare.set_defaults(func=cmd_compare)
+
+    listing = sub.add_parser("list", help="저장된 설정 목록")
+    listing.add_argument("--store", required=True, help="기준값 JSON 파일")
+    listing.set_defaults(func=cmd_list)
+
+    args = parser.parse_args()
+    return args.func(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,68 @@
+// 전역 operator new를 대체해 스레드별 힙 할당 횟수를 센다
+// 대체 operator new는 프로그램에 하나만 있어야 하므로 드라이버 cpp 한 곳에서만 include 할 것
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+// 현재 스레드에서 발생한 힙 할당 횟수 (RocksDB 백그라운드 스레드의 할당은 포함되지 않음)
+inline thread_local uint64_t t_alloc_count = 0;
+
+inline uint64_t ThreadAllocCount() { return t_alloc_count; }
+
+void* operator new(std::size_t size) {
+    ++t_alloc_count;
+    if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    ++t_alloc_count;
+    if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+
+// 정렬 할당도 RocksDB 내부에서 쓰이므로 함께 센다
+void* operator new(std::size_t size, std::align_val_t align) {
+    ++t_alloc_count;
+    std::size_t a = static_cast<std::size_t>(align);
+    if (void* p = std::aligned_alloc(a, (size + a - 1) / a * a)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t align) {
+    return operator new(size, align);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+// 측정 구간의 할당 횟수 누적
+//   harness: 벤치마크 코드 자체(키/값 준비)의 할당 → steady state에서 0이어야 함
+//   total:   RocksDB 호출을 포함한 연산 전체의 할당
+struct AllocStats {
+    uint64_t harness = 0;
+    uint64_t total = 0;
+    uint64_t ops = 0;
+};
+
+// 할당 횟수 출력. check가 true이고 벤치마크 코드에서 할당이 있었으면 실패로 종료
+inline void printAllocSummary(const std::string& name, const AllocStats& stats, bool check) {
+    std::cout << name << " 힙 할당 - 벤치마크 코드: " << stats.harness
+              << ", RocksDB 포함 전체: " << stats.total;
+    if (stats.ops > 0) std::cout << " (연산당 " << static_cast<double>(stats.total) / stats.ops << ")";
+    std::cout << std::endl;
+    if (check && stats.harness != 0) {
+        std::cerr << name << " 측정 구간에서 벤치마크 코드의 힙 할당이 0이 아닙니다: " << stats.harness << std::endl;
+        exit(1);
+    }
+}
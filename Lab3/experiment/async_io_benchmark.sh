@@ -0,0 +1,68 @@
+#!/bin/bash
+
+DB_PATH="./mydb"
+LOG_DIR="./exp_log_async_io"
+NUM_KEYS=1000000
+HOT_START=0
+HOT_END=199999
+VALUE_SIZE=$((16 * 1024))  # 16KB
+HOT_RATIO=70
+
+mkdir -p "$LOG_DIR"
+
+# 실행 파일
+WRITE_EXEC="./rocksdb_benchmark"
+READ_EXEC="./rocksdb_read_benchmark"
+
+# 고정된 컴팩션 / 압축 설정
+HOT_COMPACTION="level"
+COLD_COMPACTION="universal"
+HOT_COMPRESSION="LZ4"
+COLD_COMPRESSION="ZSTD"
+
+# cold 읽기 경로 조합: "모드 큐깊이 io_uring" (sync 1 false = pread 기준선)
+declare -a IO_CONFIGS=(
+    "sync 1 false"
+    "sync 8 false"
+    "sync 8 true"
+    "async 8 true"
+    "async 32 true"
+    "async 8 false"
+    "async 32 false"
+)
+
+# cold 키 range scan (async_io + readahead)
+SCAN_OPTS="--cold_scan_ops=2000 --scan_length=100 --cold_readahead_kb=256"
+
+# 실험 반복 횟수
+NUM_RUNS=3
+
+for ((run=1; run<=NUM_RUNS; run++)); do
+    echo "실험 반복 $run 시작"
+
+    WRITE_LOG="$LOG_DIR/write_run${run}.log"
+    echo "쓰기 실험 시작 (반복 $run) → 로그: $WRITE_LOG"
+
+    rm -rf "$DB_PATH"
+    "$WRITE_EXEC" "$DB_PATH" "$NUM_KEYS" "$HOT_START" "$HOT_END" "$VALUE_SIZE" "$HOT_RATIO" \
+        "$COLD_COMPACTION" "$HOT_COMPACTION" "$COLD_COMPRESSION" "$HOT_COMPRESSION" \
+        > "$WRITE_LOG" 2>&1
+
+    for CONFIG in "${IO_CONFIGS[@]}"; do
+        read -r MODE QD URING <<< "$CONFIG"
+        READ_LOG="$LOG_DIR/read_${MODE}_qd${QD}_uring${URING}_run${run}.log"
+
+        echo "읽기 실험 시작: mode=$MODE, queue_depth=$QD, io_uring=$URING (반복 $run)"
+        echo "→ 로그: $READ_LOG"
+
+        "$READ_EXEC" "$DB_PATH" "$NUM_KEYS" "$HOT_START" "$HOT_END" "$VALUE_SIZE" "$HOT_RATIO" \
+            "$COLD_COMPACTION" "$HOT_COMPACTION" "$COLD_COMPRESSION" "$HOT_COMPRESSION" \
+            --cold_io_mode=$MODE --queue_depth=$QD --io_uring=$URING $SCAN_OPTS \
+            > "$READ_LOG" 2>&1
+    done
+
+    echo "실험 반복 $run 완료 ✅"
+    echo "================================="
+done
+
+echo "모든 실험 완료 ✅"
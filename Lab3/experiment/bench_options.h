@@ -0,0 +1,293 @@
+// 쓰기/읽기 벤치마크가 같은 옵션으로 DB를 열 수 있도록 공통 옵션 파싱을 모아둔 헤더
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <sys/utsname.h>
+#include <rocksdb/cache.h>
+#include <rocksdb/db.h>
+#include <rocksdb/options.h>
+#include <rocksdb/slice.h>
+#include <rocksdb/statistics.h>
+#include <rocksdb/table.h>
+#include <rocksdb/version.h>
+
+// 문자열을 RocksDB CompactionStyle enum으로 변환
+inline rocksdb::CompactionStyle parseCompactionStyle(const std::string& style_str) {
+    if (style_str == "level") return rocksdb::kCompactionStyleLevel;
+    if (style_str == "universal") return rocksdb::kCompactionStyleUniversal;
+    if (style_str == "fifo") return rocksdb::kCompactionStyleFIFO;
+    if (style_str == "none") return rocksdb::kCompactionStyleNone;
+    std::cerr << "지원하지 않는 compaction 스타일: " << style_str << std::endl;
+    exit(1);
+}
+
+// 문자열을 RocksDB CompressionType enum으로 변환
+inline rocksdb::CompressionType parseCompressionType(const std::string& comp_str) {
+    if (comp_str == "none") return rocksdb::kNoCompression;
+    if (comp_str == "Snappy") return rocksdb::kSnappyCompression;
+    if (comp_str == "Zlib") return rocksdb::kZlibCompression;
+    if (comp_str == "BZip2") return rocksdb::kBZip2Compression;
+    if (comp_str == "LZ4") return rocksdb::kLZ4Compression;
+    if (comp_str == "ZSTD") return rocksdb::kZSTD;
+    std::cerr << "지원하지 않는 압축 방식: " << comp_str << std::endl;
+    exit(1);
+}
+
+// "LZ4,LZ4,ZSTD" 처럼 쉼표로 구분된 문자열을 분리
+inline std::vector<std::string> splitList(const std::string& str, char delim = ',') {
+    std::vector<std::string> items;
+    std::stringstream ss(str);
+    std::string item;
+    while (std::getline(ss, item, delim)) {
+        if (!item.empty()) items.push_back(item);
+    }
+    return items;
+}
+
+// 필수 인자 뒤에 오는 --key=value 형태의 추가 옵션
+// CF별 옵션은 --hot.key=value / --default.key=value 처럼 CF 이름을 앞에 붙인다
+using ExtraOptions = std::map<std::string, std::string>;
+
+inline ExtraOptions parseExtraOptions(int argc, char** argv, int first) {
+    ExtraOptions opts;
+    for (int i = first; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.rfind("--", 0) != 0) {
+            std::cerr << "추가 옵션은 --key=value 형식이어야 합니다: " << arg << std::endl;
+            exit(1);
+        }
+        auto eq = arg.find('=');
+        if (eq == std::string::npos) {
+            opts[arg.substr(2)] = "true";  // --flag 는 true로 간주
+        } else {
+            opts[arg.substr(2, eq - 2)] = arg.substr(eq + 1);
+        }
+    }
+    return opts;
+}
+
+// CF 전용 옵션(cf.key)이 있으면 우선 사용하고, 없으면 공통 옵션(key), 그것도 없으면 기본값
+inline std::string getOption(const ExtraOptions& opts, const std::string& key,
+                             const std::string& def = "", const std::string& cf = "") {
+    if (!cf.empty()) {
+        auto it = opts.find(cf + "." + key);
+        if (it != opts.end()) return it->second;
+    }
+    auto it = opts.find(key);
+    return it != opts.end() ? it->second : def;
+}
+
+inline uint64_t getOptionU64(const ExtraOptions& opts, const std::string& key,
+                             uint64_t def, const std::string& cf = "") {
+    std::string v = getOption(opts, key, "", cf);
+    return v.empty() ? def : std::stoull(v);
+}
+
+inline bool getOptionBool(const ExtraOptions& opts, const std::string& key,
+                          bool def, const std::string& cf = "") {
+    std::string v = getOption(opts, key, "", cf);
+    if (v.empty()) return def;
+    return v == "true" || v == "1";
+}
+
+// 레벨별 압축, bottommost 압축, ZSTD 사전 학습 옵션 적용
+//   --<cf>.compression_per_level=none,none,LZ4,LZ4,ZSTD
+//   --<cf>.bottommost_compression=ZSTD
+//   --<cf>.max_dict_bytes=16384 --<cf>.zstd_max_train_bytes=1638400
+inline void applyCompressionOptions(rocksdb::ColumnFamilyOptions& cf_options,
+                                    const ExtraOptions& opts, const std::string& cf) {
+    std::string per_level = getOption(opts, "compression_per_level", "", cf);
+    if (!per_level.empty()) {
+        cf_options.compression_per_level.clear();
+        for (const auto& c : splitList(per_level)) {
+            cf_options.compression_per_level.push_back(parseCompressionType(c));
+        }
+    }
+
+    cf_options.compression_opts.max_dict_bytes =
+        static_cast<uint32_t>(getOptionU64(opts, "max_dict_bytes", 0, cf));
+    cf_options.compression_opts.zstd_max_train_bytes =
+        static_cast<uint32_t>(getOptionU64(opts, "zstd_max_train_bytes", 0, cf));
+
+    std::string bottommost = getOption(opts, "bottommost_compression", "", cf);
+    if (!bottommost.empty()) {
+        cf_options.bottommost_compression = parseCompressionType(bottommost);
+        // 마지막 레벨에도 같은 사전 설정을 사용
+        cf_options.bottommost_compression_opts = cf_options.compression_opts;
+        cf_options.bottommost_compression_opts.enabled = true;
+    }
+}
+
+// 레벨 크기 / TTL 관련 옵션 적용 (지정된 옵션만 덮어씀)
+//   --<cf>.max_bytes_for_level_base=67108864 --<cf>.max_bytes_for_level_multiplier=4
+//   --<cf>.level_compaction_dynamic_level_bytes=true
+//   --<cf>.ttl=3600 --<cf>.periodic_compaction_seconds=3600
+inline void applyLevelOptions(rocksdb::ColumnFamilyOptions& cf_options,
+                              const ExtraOptions& opts, const std::string& cf) {
+    std::string v;
+    if (!(v = getOption(opts, "max_bytes_for_level_base", "", cf)).empty())
+        cf_options.max_bytes_for_level_base = std::stoull(v);
+    if (!(v = getOption(opts, "max_bytes_for_level_multiplier", "", cf)).empty())
+        cf_options.max_bytes_for_level_multiplier = std::stod(v);
+    if (!(v = getOption(opts, "level_compaction_dynamic_level_bytes", "", cf)).empty())
+        cf_options.level_compaction_dynamic_level_bytes = (v == "true" || v == "1");
+    if (!(v = getOption(opts, "ttl", "", cf)).empty())
+        cf_options.ttl = std::stoull(v);
+    if (!(v = getOption(opts, "periodic_compaction_seconds", "", cf)).empty())
+        cf_options.periodic_compaction_seconds = std::stoull(v);
+}
+
+// 정수 키를 호출자의 버퍼(16바이트 이상)에 기록해 Slice로 반환 (힙 할당 없음)
+// padded이면 0으로 채운 10자리 키를 사용해 사전순과 숫자순을 일치시킨다 (DeleteRange용)
+inline rocksdb::Slice formatKeyTo(char* buf, int key, bool padded) {
+    int len = snprintf(buf, 16, padded ? "%010d" : "%d", key);
+    return rocksdb::Slice(buf, len);
+}
+
+inline std::string formatKey(int key, bool padded) {
+    char buf[16];
+    return formatKeyTo(buf, key, padded).ToString();
+}
+
+// churn 워크로드는 DeleteRange를 쓰므로 기본으로 padded 키를 사용
+inline bool usePaddedKeys(const ExtraOptions& opts) {
+    return getOptionBool(opts, "padded_keys", getOption(opts, "workload", "insert") == "churn");
+}
+
+// 블록 캐시 뒤에 CompressedSecondaryCache 계층을 두는 공유 캐시 생성
+//   --block_cache_mb=512 --compressed_secondary_cache_mb=1024
+//   --secondary_cache_compression=LZ4
+// 두 옵션 모두 없으면 nullptr (RocksDB 기본 블록 캐시 사용)
+inline std::shared_ptr<rocksdb::Cache> makeBlockCache(const ExtraOptions& opts) {
+    uint64_t block_cache_mb = getOptionU64(opts, "block_cache_mb", 0);
+    uint64_t secondary_mb = getOptionU64(opts, "compressed_secondary_cache_mb", 0);
+    if (block_cache_mb == 0 && secondary_mb == 0) return nullptr;
+
+    rocksdb::LRUCacheOptions lru_opts;
+    lru_opts.capacity = (block_cache_mb == 0 ? 32 : block_cache_mb) << 20;  // 기본 32MB
+    if (secondary_mb > 0) {
+        rocksdb::CompressedSecondaryCacheOptions sec_opts;
+        sec_opts.capacity = secondary_mb << 20;
+        sec_opts.compression_type =
+            parseCompressionType(getOption(opts, "secondary_cache_compression", "LZ4"));
+        lru_opts.secondary_cache = rocksdb::NewCompressedSecondaryCache(sec_opts);
+    }
+    return rocksdb::NewLRUCache(lru_opts);
+}
+
+// 공유 블록 캐시를 CF의 table factory에 연결
+inline void applyTableOptions(rocksdb::ColumnFamilyOptions& cf_options,
+                              const std::shared_ptr<rocksdb::Cache>& cache) {
+    if (!cache) return;
+    rocksdb::BlockBasedTableOptions table_options;
+    table_options.block_cache = cache;
+    cf_options.table_factory.reset(rocksdb::NewBlockBasedTableFactory(table_options));
+}
+
+// 캐시 계층과 압축 해제 횟수 요약 출력
+inline void printCacheSummary(const std::shared_ptr<rocksdb::Statistics>& statistics) {
+    uint64_t hit = statistics->getTickerCount(rocksdb::BLOCK_CACHE_DATA_HIT);
+    uint64_t miss = statistics->getTickerCount(rocksdb::BLOCK_CACHE_DATA_MISS);
+    std::cout << "블록 캐시 데이터 hit: " << hit << ", miss: " << miss;
+    if (hit + miss > 0) std::cout << " (hit율 " << 100.0 * hit / (hit + miss) << "%)";
+    std::cout << std::endl;
+    std::cout << "secondary 캐시 hit: "
+              << statistics->getTickerCount(rocksdb::SECONDARY_CACHE_HITS) << std::endl;
+    std::cout << "압축 해제된 블록 수: "
+              << statistics->getTickerCount(rocksdb::NUMBER_BLOCK_DECOMPRESSED) << std::endl;
+}
+
+// 지연 시간(us) 목록의 평균/p50/p99/max 출력
+inline void printLatencySummary(const std::string& name, std::vector<uint64_t>& lat_us) {
+    if (lat_us.empty()) {
+        std::cout << name << " 지연 시간: 샘플 없음" << std::endl;
+        return;
+    }
+    std::sort(lat_us.begin(), lat_us.end());
+    double sum = 0;
+    for (auto v : lat_us) sum += v;
+    std::cout << name << " 지연 시간(us) - 샘플: " << lat_us.size()
+              << ", 평균: " << sum / lat_us.size()
+              << ", p50: " << lat_us[lat_us.size() * 50 / 100]
+              << ", p99: " << lat_us[lat_us.size() * 99 / 100]
+              << ", max: " << lat_us.back() << std::endl;
+}
+
+// WAF = (flush + compaction으로 기록한 바이트) / 사용자가 기록한 바이트
+inline double computeWriteAmp(const std::shared_ptr<rocksdb::Statistics>& statistics) {
+    uint64_t user_bytes = statistics->getTickerCount(rocksdb::BYTES_WRITTEN);
+    uint64_t flush_bytes = statistics->getTickerCount(rocksdb::FLUSH_WRITE_BYTES);
+    uint64_t compact_bytes = statistics->getTickerCount(rocksdb::COMPACT_WRITE_BYTES);
+    return user_bytes == 0 ? 0.0 : static_cast<double>(flush_bytes + compact_bytes) / user_bytes;
+}
+
+// CF별 tombstone 수 출력 (memtable + SST)
+inline void printTombstoneSummary(rocksdb::DB* db, rocksdb::ColumnFamilyHandle* handle,
+                                  const std::string& name) {
+    uint64_t mem_deletes = 0, imm_deletes = 0;
+    db->GetIntProperty(handle, "rocksdb.num-deletes-active-mem-table", &mem_deletes);
+    db->GetIntProperty(handle, "rocksdb.num-deletes-imm-mem-tables", &imm_deletes);
+
+    std::map<std::string, std::string> props;
+    db->GetMapProperty(handle, rocksdb::DB::Properties::kAggregatedTableProperties, &props);
+    auto prop = [&](const std::string& key) {
+        auto it = props.find(key);
+        return it == props.end() ? std::string("0") : it->second;
+    };
+
+    std::cout << name << " tombstone - memtable: " << mem_deletes + imm_deletes
+              << ", SST point delete: " << prop("num_deletions")
+              << ", SST range delete: " << prop("num_range_deletions")
+              << " (SST 전체 엔트리: " << prop("num_entries") << ")" << std::endl;
+}
+
+// compaction 중 제거된 tombstone / 덮어쓴 키 수 출력
+inline void printCompactionDropSummary(const std::shared_ptr<rocksdb::Statistics>& statistics) {
+    std::cout << "compaction 제거 - 덮어쓴 키: "
+              << statistics->getTickerCount(rocksdb::COMPACTION_KEY_DROP_NEWER_ENTRY)
+              << ", 삭제된 키: "
+              << statistics->getTickerCount(rocksdb::COMPACTION_KEY_DROP_OBSOLETE)
+              << ", range delete로 가려진 키: "
+              << statistics->getTickerCount(rocksdb::COMPACTION_KEY_DROP_RANGE_DEL)
+              << ", 만료된 range tombstone: "
+              << statistics->getTickerCount(rocksdb::COMPACTION_RANGE_DEL_DROP_OBSOLETE)
+              << std::endl;
+}
+
+// 공간 증폭 = 전체 SST 크기 / 추정 live 데이터 크기 (여러 DB에 걸친 CF도 합산)
+inline void printSpaceAmp(
+    const std::vector<std::pair<rocksdb::DB*, rocksdb::ColumnFamilyHandle*>>& cfs) {
+    uint64_t sst_bytes = 0, live_bytes = 0;
+    for (const auto& [db, h] : cfs) {
+        uint64_t v = 0;
+        if (db->GetIntProperty(h, "rocksdb.total-sst-files-size", &v)) sst_bytes += v;
+        if (db->GetIntProperty(h, "rocksdb.estimate-live-data-size", &v)) live_bytes += v;
+    }
+    std::cout << "SST 크기: " << sst_bytes << ", live 데이터 크기: " << live_bytes << std::endl;
+    if (live_bytes > 0) std::cout << "공간 증폭: " << static_cast<double>(sst_bytes) / live_bytes << std::endl;
+}
+
+// 빌드한 소스의 커밋: -DBENCH_GIT_COMMIT="\"$(git rev-parse --short HEAD)\"" 로 지정
+#ifndef BENCH_GIT_COMMIT
+#define BENCH_GIT_COMMIT "unknown"
+#endif
+
+// 결과 비교 시 환경 구분용 빌드 / 실행 환경 정보 (bench_compare.py가 로그에서 읽음)
+inline void printBuildInfo() {
+    std::cout << "RocksDB 버전: " << ROCKSDB_MAJOR << "." << ROCKSDB_MINOR << "." << ROCKSDB_PATCH << std::endl;
+    std::cout << "컴파일러: " << __VERSION__ << std::endl;
+    std::cout << "빌드 커밋: " << BENCH_GIT_COMMIT << std::endl;
+    struct utsname uts;
+    if (uname(&uts) == 0) {
+        std::cout << "커널: " << uts.release << std::endl;
+        std::cout << "아키텍처: " << uts.machine << std::endl;
+    }
+}
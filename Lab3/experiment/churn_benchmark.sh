@@ -0,0 +1,66 @@
+#!/bin/bash
+
+DB_PATH="./mydb"
+LOG_DIR="./exp_log_churn"
+NUM_KEYS=1000000
+HOT_START=0
+HOT_END=199999
+VALUE_SIZE=$((16 * 1024))  # 16KB
+HOT_RATIO=70
+
+mkdir -p "$LOG_DIR"
+
+# 실행 파일
+EXEC="./rocksdb_benchmark"
+
+# 고정된 컴팩션 / 압축 방식
+HOT_COMPACTION="level"
+COLD_COMPACTION="universal"
+HOT_COMPRESSION="LZ4"
+COLD_COMPRESSION="ZSTD"
+
+# 연산 혼합 비율: "이름 delete_pct delete_range_pct single_delete_pct" (나머지는 overwrite)
+declare -a OP_MIXES=(
+    "overwrite 0 0 0"
+    "point_delete 30 0 0"
+    "range_delete 0 10 0"
+    "single_delete 0 0 30"
+    "mixed 15 5 10"
+)
+
+# Lab1 가설 2의 hot CF 레벨 크기 설정 (db_bench 결과를 커스텀 하니스에서 재확인)
+max_bytes_for_level_base=(67108864 268435456)  # 64MB, 256MB
+max_bytes_for_level_multiplier=(4 10)
+
+# 실험 반복 횟수
+NUM_RUNS=3
+
+for ((run=1; run<=NUM_RUNS; run++)); do
+    for MIX in "${OP_MIXES[@]}"; do
+        read -r MIX_NAME DELETE_PCT RANGE_PCT SINGLE_PCT <<< "$MIX"
+
+        for level_base in "${max_bytes_for_level_base[@]}"; do
+            for multiplier in "${max_bytes_for_level_multiplier[@]}"; do
+                LOG_FILE="$LOG_DIR/churn_${MIX_NAME}_base${level_base}_mult${multiplier}_run${run}.log"
+
+                echo "실험 시작: mix=$MIX_NAME, base=$level_base, multiplier=$multiplier (반복 $run)"
+                echo "→ 로그: $LOG_FILE"
+
+                rm -rf "$DB_PATH"
+
+                "$EXEC" "$DB_PATH" "$NUM_KEYS" "$HOT_START" "$HOT_END" "$VALUE_SIZE" "$HOT_RATIO" \
+                    "$COLD_COMPACTION" "$HOT_COMPACTION" "$COLD_COMPRESSION" "$HOT_COMPRESSION" \
+                    --workload=churn --churn_ops="$NUM_KEYS" \
+                    --delete_pct="$DELETE_PCT" --delete_range_pct="$RANGE_PCT" --single_delete_pct="$SINGLE_PCT" \
+                    --hot.max_bytes_for_level_base="$level_base" \
+                    --hot.max_bytes_for_level_multiplier="$multiplier" \
+                    > "$LOG_FILE" 2>&1
+
+                echo "완료됨: $LOG_FILE"
+                echo "-------------------------------"
+            done
+        done
+    done
+done
+
+echo "모든 실험 완료 ✅"
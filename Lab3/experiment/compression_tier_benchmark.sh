@@ -0,0 +1,79 @@
+#!/bin/bash
+
+DB_PATH="./mydb"
+LOG_DIR="./exp_log_tier"
+NUM_KEYS=1000000
+HOT_START=0
+HOT_END=199999
+VALUE_SIZE=$((16 * 1024))  # 16KB
+HOT_RATIO=70
+
+mkdir -p "$LOG_DIR"
+
+# 실행 파일
+WRITE_EXEC="./rocksdb_benchmark"
+READ_EXEC="./rocksdb_read_benchmark"
+
+# 고정된 컴팩션 스타일 / hot 압축
+HOT_COMPACTION="level"
+COLD_COMPACTION="universal"
+HOT_COMPRESSION="LZ4"
+COLD_COMPRESSION="ZSTD"
+
+# 블록 캐시 크기 (MB)
+BLOCK_CACHE_MB=256
+
+# cold CF 압축 구성: "이름|추가 옵션"
+#   상위 레벨은 LZ4로 빠르게, 마지막 레벨만 ZSTD(+사전)로 작게 저장
+declare -a COLD_CONFIGS=(
+    "single|"
+    "per_level|--default.compression_per_level=none,LZ4,LZ4,LZ4,LZ4,LZ4,ZSTD --default.bottommost_compression=ZSTD"
+    "per_level_dict|--default.compression_per_level=none,LZ4,LZ4,LZ4,LZ4,LZ4,ZSTD --default.bottommost_compression=ZSTD --default.max_dict_bytes=16384 --default.zstd_max_train_bytes=1638400"
+)
+
+# compressed secondary cache 크기 (MB), 0 = 사용 안 함
+SECONDARY_CACHE_MBS=(0 1024)
+
+# 실험 반복 횟수
+NUM_RUNS=3
+
+for ((run=1; run<=NUM_RUNS; run++)); do
+    echo "실험 반복 $run 시작"
+
+    for CONFIG in "${COLD_CONFIGS[@]}"; do
+        IFS='|' read -r CONFIG_NAME COLD_OPTS <<< "$CONFIG"
+
+        for SEC_MB in "${SECONDARY_CACHE_MBS[@]}"; do
+            EXTRA_OPTS="$COLD_OPTS --block_cache_mb=$BLOCK_CACHE_MB --compressed_secondary_cache_mb=$SEC_MB"
+
+            WRITE_LOG="$LOG_DIR/write_${CONFIG_NAME}_sec${SEC_MB}_run${run}.log"
+            READ_LOG="$LOG_DIR/read_${CONFIG_NAME}_sec${SEC_MB}_run${run}.log"
+
+            echo "쓰기 실험 시작: cold=$CONFIG_NAME, secondary=${SEC_MB}MB (반복 $run)"
+            echo "→ 로그: $WRITE_LOG"
+
+            rm -rf "$DB_PATH"
+
+            "$WRITE_EXEC" "$DB_PATH" "$NUM_KEYS" "$HOT_START" "$HOT_END" "$VALUE_SIZE" "$HOT_RATIO" \
+                "$COLD_COMPACTION" "$HOT_COMPACTION" "$COLD_COMPRESSION" "$HOT_COMPRESSION" $EXTRA_OPTS \
+                > "$WRITE_LOG" 2>&1
+
+            echo "읽기 실험 시작: cold=$CONFIG_NAME, secondary=${SEC_MB}MB (반복 $run)"
+            echo "→ 로그: $READ_LOG"
+
+            "$READ_EXEC" "$DB_PATH" "$NUM_KEYS" "$HOT_START" "$HOT_END" "$VALUE_SIZE" "$HOT_RATIO" \
+                "$COLD_COMPACTION" "$HOT_COMPACTION" "$COLD_COMPRESSION" "$HOT_COMPRESSION" $EXTRA_OPTS \
+                > "$READ_LOG" 2>&1
+
+            echo "DB 크기: $(du -sb "$DB_PATH" | cut -f1) bytes" >> "$READ_LOG"
+
+            echo "완료됨: cold=$CONFIG_NAME, secondary=${SEC_MB}MB (반복 $run)"
+            echo "-------------------------------"
+        done
+    done
+
+    echo "실험 반복 $run 완료 ✅"
+    echo "================================="
+done
+
+echo "모든 실험 완료 ✅"
@@ -0,0 +1,79 @@
+#!/bin/bash
+
+DB_PATH="./mydb"
+LOG_DIR="./exp_log_io_mode"
+NUM_KEYS=1000000
+HOT_START=0
+HOT_END=199999
+VALUE_SIZE=$((16 * 1024))  # 16KB
+HOT_RATIO=70
+
+mkdir -p "$LOG_DIR"
+
+# 실행 파일
+WRITE_EXEC="./rocksdb_benchmark"
+READ_EXEC="./rocksdb_read_benchmark"
+
+# 고정된 컴팩션 / 압축 설정
+HOT_COMPACTION="level"
+COLD_COMPACTION="universal"
+HOT_COMPRESSION="LZ4"
+COLD_COMPRESSION="ZSTD"
+
+# 파일 I/O 방식
+FILE_IO_MODES=(buffered direct mmap)
+
+# 공통 I/O 옵션 (블록 캐시 크기를 고정해 페이지 캐시와의 역할 분담을 비교)
+IO_OPTS="--block_cache_mb=256 --compaction_readahead_kb=2048 --bytes_per_sync_kb=1024 --wal_bytes_per_sync_kb=1024 --rate_limit_mb=200"
+
+# 페이지 캐시 압박: 메모리 상한이 있는 cgroup에서 실행 (페이지 캐시도 cgroup 메모리에 포함됨)
+# 빈 값이면 제한 없이 실행
+MEMORY_LIMIT="1G"
+
+# 워밍업 / steady state 판정 (페이지 캐시 압박 하에서 지연 시간 안정성 확인용)
+STEADY_OPTS="--warmup_ops=100000 --window_ops=10000 --steady_windows=5 --steady_cv=0.1"
+
+# 실험 반복 횟수
+NUM_RUNS=3
+
+run_limited() {
+    if [[ -n "$MEMORY_LIMIT" ]]; then
+        systemd-run --user --scope --quiet -p MemoryMax="$MEMORY_LIMIT" "$@"
+    else
+        "$@"
+    fi
+}
+
+for ((run=1; run<=NUM_RUNS; run++)); do
+    echo "실험 반복 $run 시작"
+
+    for FILE_IO in "${FILE_IO_MODES[@]}"; do
+        WRITE_LOG="$LOG_DIR/write_${FILE_IO}_run${run}.log"
+        READ_LOG="$LOG_DIR/read_${FILE_IO}_run${run}.log"
+
+        echo "쓰기 실험 시작: file_io=$FILE_IO (반복 $run)"
+        echo "→ 로그: $WRITE_LOG"
+
+        rm -rf "$DB_PATH"
+        run_limited "$WRITE_EXEC" "$DB_PATH" "$NUM_KEYS" "$HOT_START" "$HOT_END" "$VALUE_SIZE" "$HOT_RATIO" \
+            "$COLD_COMPACTION" "$HOT_COMPACTION" "$COLD_COMPRESSION" "$HOT_COMPRESSION" \
+            --file_io=$FILE_IO $IO_OPTS $STEADY_OPTS \
+            > "$WRITE_LOG" 2>&1
+
+        echo "읽기 실험 시작: file_io=$FILE_IO (반복 $run)"
+        echo "→ 로그: $READ_LOG"
+
+        run_limited "$READ_EXEC" "$DB_PATH" "$NUM_KEYS" "$HOT_START" "$HOT_END" "$VALUE_SIZE" "$HOT_RATIO" \
+            "$COLD_COMPACTION" "$HOT_COMPACTION" "$COLD_COMPRESSION" "$HOT_COMPRESSION" \
+            --file_io=$FILE_IO $IO_OPTS $STEADY_OPTS \
+            > "$READ_LOG" 2>&1
+
+        echo "완료됨: file_io=$FILE_IO (반복 $run)"
+        echo "-------------------------------"
+    done
+
+    echo "실험 반복 $run 완료 ✅"
+    echo "================================="
+done
+
+echo "모든 실험 완료 ✅"
@@ -0,0 +1,69 @@
+// 파일 I/O 방식(buffered / Direct-I/O / mmap), readahead, sync 주기, rate limiter 옵션
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <rocksdb/options.h>
+#include <rocksdb/rate_limiter.h>
+#include "bench_options.h"
+
+// DB 단위 I/O 옵션 적용
+//   --file_io=buffered|direct|mmap   I/O 방식 묶음 (기본 buffered)
+//       direct: use_direct_reads + use_direct_io_for_flush_and_compaction (페이지 캐시 우회)
+//       mmap:   allow_mmap_reads + allow_mmap_writes
+//   --direct_reads / --direct_io_for_flush_and_compaction / --mmap_reads / --mmap_writes
+//                                    묶음 대신 개별 지정 (묶음보다 우선)
+//   --compaction_readahead_kb=2048   compaction 입력 파일 readahead 크기
+//   --bytes_per_sync_kb=1024 --wal_bytes_per_sync_kb=1024
+//                                    지정한 크기만큼 쓸 때마다 백그라운드로 sync (0이면 비활성)
+//   --rate_limit_mb=100              flush/compaction 쓰기 속도 제한 (MB/s, 0이면 제한 없음)
+//   --rate_limit_auto_tune=true      rate limiter 자동 조정
+// Direct-I/O와 mmap 읽기는 함께 쓸 수 없으며, 이 경우 DB::Open이 InvalidArgument를 반환한다
+inline void applyIoOptions(rocksdb::Options& options, const ExtraOptions& opts) {
+    std::string file_io = getOption(opts, "file_io", "buffered");
+    bool direct = (file_io == "direct");
+    bool mmap = (file_io == "mmap");
+    if (!direct && !mmap && file_io != "buffered") {
+        std::cerr << "알 수 없는 file_io: " << file_io << " (buffered / direct / mmap)" << std::endl;
+        exit(1);
+    }
+
+    options.use_direct_reads = getOptionBool(opts, "direct_reads", direct);
+    options.use_direct_io_for_flush_and_compaction =
+        getOptionBool(opts, "direct_io_for_flush_and_compaction", direct);
+    options.allow_mmap_reads = getOptionBool(opts, "mmap_reads", mmap);
+    options.allow_mmap_writes = getOptionBool(opts, "mmap_writes", mmap);
+
+    std::string v;
+    if (!(v = getOption(opts, "compaction_readahead_kb")).empty())
+        options.compaction_readahead_size = std::stoull(v) << 10;
+    if (!(v = getOption(opts, "bytes_per_sync_kb")).empty())
+        options.bytes_per_sync = std::stoull(v) << 10;
+    if (!(v = getOption(opts, "wal_bytes_per_sync_kb")).empty())
+        options.wal_bytes_per_sync = std::stoull(v) << 10;
+
+    uint64_t rate_limit_mb = getOptionU64(opts, "rate_limit_mb", 0);
+    if (rate_limit_mb > 0) {
+        options.rate_limiter.reset(rocksdb::NewGenericRateLimiter(
+            static_cast<int64_t>(rate_limit_mb << 20), 100 * 1000 /* refill_period_us */, 10 /* fairness */,
+            rocksdb::RateLimiter::Mode::kWritesOnly, getOptionBool(opts, "rate_limit_auto_tune", false)));
+    }
+}
+
+// 적용된 I/O 옵션 출력 (로그만으로 실험 조건을 알 수 있도록)
+inline void printIoOptions(const rocksdb::Options& options) {
+    std::cout << "I/O 방식 - direct 읽기: " << options.use_direct_reads
+              << ", direct flush/compaction: " << options.use_direct_io_for_flush_and_compaction
+              << ", mmap 읽기: " << options.allow_mmap_reads
+              << ", mmap 쓰기: " << options.allow_mmap_writes << std::endl;
+    std::cout << "compaction readahead: " << (options.compaction_readahead_size >> 10) << "KB"
+              << ", bytes_per_sync: " << (options.bytes_per_sync >> 10) << "KB"
+              << ", wal_bytes_per_sync: " << (options.wal_bytes_per_sync >> 10) << "KB"
+              << ", rate limit: ";
+    if (options.rate_limiter) {
+        std::cout << (options.rate_limiter->GetBytesPerSecond() >> 20) << "MB/s";
+    } else {
+        std::cout << "없음";
+    }
+    std::cout << std::endl;
+}
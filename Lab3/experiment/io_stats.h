@@ -0,0 +1,145 @@
+// DB가 위치한 블록 디바이스의 I/O 지표 (Linux /sys/dev/block/<major>:<minor>/stat)와
+// 프로세스 I/O 카운터(/proc/self/io)로 본 페이지 캐시 / 블록 캐시 바이트 분해
+#pragma once
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+#include <rocksdb/statistics.h>
+
+struct DeviceStats {
+    uint64_t read_ios = 0;
+    uint64_t read_sectors = 0;
+    uint64_t write_ios = 0;
+    uint64_t write_sectors = 0;
+    uint64_t io_ticks_ms = 0;        // 디바이스가 I/O를 처리 중이던 시간
+    uint64_t time_in_queue_ms = 0;   // 요청별 대기 시간 합 (평균 큐 깊이 계산용)
+};
+
+// 경로가 속한 디바이스의 stat 파일 경로 (tmpfs 등 블록 디바이스가 아니면 빈 문자열)
+inline std::string deviceStatPath(const std::string& path) {
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) return "";
+    std::string stat_path = "/sys/dev/block/" + std::to_string(major(st.st_dev)) + ":" +
+                            std::to_string(minor(st.st_dev)) + "/stat";
+    std::ifstream in(stat_path);
+    return in.good() ? stat_path : "";
+}
+
+inline bool readDeviceStats(const std::string& stat_path, DeviceStats* stats) {
+    if (stat_path.empty()) return false;
+    std::ifstream in(stat_path);
+    uint64_t read_merges, read_ticks, write_merges, write_ticks, in_flight;
+    in >> stats->read_ios >> read_merges >> stats->read_sectors >> read_ticks
+       >> stats->write_ios >> write_merges >> stats->write_sectors >> write_ticks
+       >> in_flight >> stats->io_ticks_ms >> stats->time_in_queue_ms;
+    return static_cast<bool>(in);
+}
+
+// 측정 구간의 디바이스 IOPS / 처리량 / 평균 큐 깊이 / 사용률 출력
+inline void printDeviceStatsDelta(const std::string& name, const DeviceStats& before,
+                                  const DeviceStats& after, double elapsed_sec) {
+    if (elapsed_sec <= 0) return;
+    double elapsed_ms = elapsed_sec * 1000.0;
+    uint64_t read_ios = after.read_ios - before.read_ios;
+    uint64_t write_ios = after.write_ios - before.write_ios;
+    std::cout << name << " 디바이스 - 읽기 IOPS: " << read_ios / elapsed_sec
+              << ", 쓰기 IOPS: " << write_ios / elapsed_sec
+              << ", 읽기 MB/s: " << (after.read_sectors - before.read_sectors) * 512.0 / (1 << 20) / elapsed_sec
+              << ", 평균 큐 깊이: " << (after.time_in_queue_ms - before.time_in_queue_ms) / elapsed_ms
+              << ", 사용률: " << 100.0 * (after.io_ticks_ms - before.io_ticks_ms) / elapsed_ms << "%"
+              << std::endl;
+}
+
+// async_io MultiGet이 실제로 코루틴 경로를 탔는지 확인
+// RocksDB가 USE_COROUTINES 없이 빌드되면 async_io + optimize_multiget_for_io가 조용히 동기 경로로 대체되므로
+// 코루틴 MultiGet에서만 증가하는 MULTIGET_COROUTINE_COUNT ticker로 판단한다
+inline void printAsyncMultiGetSupport(const std::shared_ptr<rocksdb::Statistics>& statistics, bool async_requested) {
+    uint64_t coroutines = statistics->getTickerCount(rocksdb::MULTIGET_COROUTINE_COUNT);
+    std::cout << "코루틴 MultiGet 수: " << coroutines;
+    if (async_requested && coroutines == 0) {
+        std::cout << " (async_io를 요청했지만 코루틴 경로가 쓰이지 않음: RocksDB가 코루틴 없이 빌드되었거나"
+                  << " 여러 레벨에 걸친 MultiGet이 없었음 → 동기 경로와 같은 결과)";
+    }
+    std::cout << std::endl;
+}
+
+// RocksDB 관점의 SST 파일 읽기 횟수 (SST_READ_MICROS 히스토그램의 샘플 수)
+inline uint64_t sstReadCount(const std::shared_ptr<rocksdb::Statistics>& statistics) {
+    rocksdb::HistogramData data;
+    statistics->histogramData(rocksdb::SST_READ_MICROS, &data);
+    return data.count;
+}
+
+// 프로세스 전체(모든 스레드)의 I/O 카운터
+struct ProcessIoStats {
+    uint64_t rchar = 0;        // read 계열 시스템 콜로 읽은 바이트 (페이지 캐시 적중 포함, mmap 제외)
+    uint64_t wchar = 0;        // write 계열 시스템 콜로 쓴 바이트
+    uint64_t read_bytes = 0;   // 실제로 스토리지에서 읽어 온 바이트
+    uint64_t write_bytes = 0;  // 스토리지로 내려가도록 dirty 처리된 바이트
+};
+
+inline bool readProcessIoStats(ProcessIoStats* stats) {
+    std::ifstream in("/proc/self/io");
+    std::string line;
+    bool found = false;
+    while (std::getline(in, line)) {
+        std::istringstream fields(line);
+        std::string key;
+        uint64_t value;
+        if (!(fields >> key >> value)) continue;
+        if (key == "rchar:") stats->rchar = value;
+        else if (key == "wchar:") stats->wchar = value;
+        else if (key == "read_bytes:") stats->read_bytes = value;
+        else if (key == "write_bytes:") stats->write_bytes = value;
+        else continue;
+        found = true;
+    }
+    return found;
+}
+
+// 구간 비교용 스냅샷: 커널 쪽 카운터와 RocksDB 블록 캐시 ticker를 같은 시점에 읽는다
+struct CacheIoSnapshot {
+    ProcessIoStats proc;
+    bool has_proc = false;
+    uint64_t block_cache_bytes_read = 0;   // 블록 캐시에서 바로 제공한 바이트
+    uint64_t block_cache_bytes_write = 0;  // 캐시 miss 후 파일에서 읽어 캐시에 넣은 바이트
+    uint64_t compact_read_bytes = 0;
+};
+
+inline CacheIoSnapshot takeCacheIoSnapshot(const std::shared_ptr<rocksdb::Statistics>& statistics) {
+    CacheIoSnapshot snap;
+    snap.has_proc = readProcessIoStats(&snap.proc);
+    snap.block_cache_bytes_read = statistics->getTickerCount(rocksdb::BLOCK_CACHE_BYTES_READ);
+    snap.block_cache_bytes_write = statistics->getTickerCount(rocksdb::BLOCK_CACHE_BYTES_WRITE);
+    snap.compact_read_bytes = statistics->getTickerCount(rocksdb::COMPACT_READ_BYTES);
+    return snap;
+}
+
+// 읽기 바이트가 어느 계층에서 제공됐는지 출력 (MB)
+//   페이지 캐시 적중 추정 = rchar - read_bytes
+//   Direct-I/O에서는 rchar ≈ read_bytes, mmap 읽기는 rchar에 잡히지 않고 page fault로만 드러난다
+inline void printCacheIoBreakdown(const std::string& name, const CacheIoSnapshot& before,
+                                  const CacheIoSnapshot& after) {
+    const double mb = 1 << 20;
+    std::cout << name << " 블록 캐시 - 적중 " << (after.block_cache_bytes_read - before.block_cache_bytes_read) / mb
+              << "MB, miss 후 적재 " << (after.block_cache_bytes_write - before.block_cache_bytes_write) / mb
+              << "MB, compaction 읽기 " << (after.compact_read_bytes - before.compact_read_bytes) / mb
+              << "MB" << std::endl;
+    if (!before.has_proc || !after.has_proc) {
+        std::cout << name << " /proc/self/io를 읽을 수 없음" << std::endl;
+        return;
+    }
+    uint64_t rchar = after.proc.rchar - before.proc.rchar;
+    uint64_t read_bytes = after.proc.read_bytes - before.proc.read_bytes;
+    std::cout << name << " 프로세스 I/O - 시스템 콜 읽기 " << rchar / mb
+              << "MB, 디바이스 읽기 " << read_bytes / mb
+              << "MB, 페이지 캐시 적중 추정 " << (rchar > read_bytes ? rchar - read_bytes : 0) / mb
+              << "MB, 시스템 콜 쓰기 " << (after.proc.wchar - before.proc.wchar) / mb
+              << "MB, 디바이스 쓰기 " << (after.proc.write_bytes - before.proc.write_bytes) / mb
+              << "MB" << std::endl;
+}
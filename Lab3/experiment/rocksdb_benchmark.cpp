@@ -9,36 +9,23 @@
 #include <rocksdb/utilities/options_util.h>
 #include <rocksdb/filter_policy.h>
 #include <rocksdb/statistics.h>
+#include <rocksdb/write_batch.h>
 #include <cassert>
 #include <chrono>
-
-// 문자열을 RocksDB CompactionStyle enum으로 변환
-rocksdb::CompactionStyle parseCompactionStyle(const std::string& style_str) {
-    if (style_str == "level") return rocksdb::kCompactionStyleLevel;
-    if (style_str == "universal") return rocksdb::kCompactionStyleUniversal;
-    if (style_str == "fifo") return rocksdb::kCompactionStyleFIFO;
-    if (style_str == "none") return rocksdb::kCompactionStyleNone;
-    std::cerr << "지원하지 않는 compaction 스타일: " << style_str << std::endl;
-    exit(1);
-}
-
-// 문자열을 RocksDB CompressionType enum으로 변환
-rocksdb::CompressionType parseCompressionType(const std::string& comp_str) {
-    if (comp_str == "none") return rocksdb::kNoCompression;
-    if (comp_str == "Snappy") return rocksdb::kSnappyCompression;
-    if (comp_str == "Zlib") return rocksdb::kZlibCompression;
-    if (comp_str == "BZip2") return rocksdb::kBZip2Compression;
-    if (comp_str == "LZ4") return rocksdb::kLZ4Compression;
-    if (comp_str == "ZSTD") return rocksdb::kZSTD;
-    std::cerr << "지원하지 않는 압축 방식: " << comp_str << std::endl;
-    exit(1);
-}
+#include <algorithm>
+#include "bench_options.h"
+#include "thread_options.h"
+#include "steady_state.h"
+#include "alloc_counter.h"
+#include "io_options.h"
+#include "io_stats.h"
 
 int main(int argc, char** argv) {
     if (argc < 11) {
         std::cerr << "사용법: " << argv[0]
                   << " <DB 경로> <총 키 수> <핫 범위 시작> <핫 범위 끝> <value 크기> <핫 접근 비율(0~100)>"
-                  << " <default compaction> <hot compaction> <default compression> <hot compression>\n";
+                  << " <default compaction> <hot compaction> <default compression> <hot compression>"
+                  << " [--key=value ...]\n";
         return 1;
     }
 
@@ -53,6 +40,7 @@ int main(int argc, char** argv) {
     std::string hot_compaction_str = argv[8];
     std::string default_compression_str = argv[9];
     std::string hot_compression_str = argv[10];
+    ExtraOptions extra = parseExtraOptions(argc, argv, 11);
 
     // DB 옵션 설정
     rocksdb::Options options;
@@ -62,14 +50,29 @@ int main(int argc, char** argv) {
     std::shared_ptr<rocksdb::Statistics> statistics = rocksdb::CreateDBStatistics();
     options.statistics = statistics;
 
+    // 백그라운드 job / 스레드 풀 크기 및 CPU 고정
+    applyThreadOptions(options, extra);
+
+    // Direct-I/O / mmap, readahead, bytes_per_sync, rate limiter
+    applyIoOptions(options, extra);
+
     // Column Family별 옵션 설정
     rocksdb::ColumnFamilyOptions default_cf_options;
     default_cf_options.compaction_style = parseCompactionStyle(default_compaction_str);
     default_cf_options.compression = parseCompressionType(default_compression_str);
+    applyCompressionOptions(default_cf_options, extra, "default");
+    applyLevelOptions(default_cf_options, extra, "default");
 
     rocksdb::ColumnFamilyOptions hot_cf_options;
     hot_cf_options.compaction_style = parseCompactionStyle(hot_compaction_str);
     hot_cf_options.compression = parseCompressionType(hot_compression_str);
+    applyCompressionOptions(hot_cf_options, extra, "hot");
+    applyLevelOptions(hot_cf_options, extra, "hot");
+
+    // 두 CF가 블록 캐시(+ compressed secondary cache)를 공유
+    auto block_cache = makeBlockCache(extra);
+    applyTableOptions(default_cf_options, block_cache);
+    applyTableOptions(hot_cf_options, block_cache);
 
     // CF Descriptor 생성
     std::vector<rocksdb::ColumnFamilyDescriptor> cf_descriptors = {
@@ -81,7 +84,12 @@ int main(int argc, char** argv) {
     rocksdb::DB* db;
     std::vector<rocksdb::ColumnFamilyHandle*> handles;
     auto status = rocksdb::DB::Open(options, db_path, cf_descriptors, &handles, &db);
-    assert(status.ok());
+    if (!status.ok()) {
+        std::cerr << "DB 오픈 실패: " << status.ToString() << std::endl;
+        return 1;
+    }
+    // DB::Open이 늘린 풀 스레드까지 백그라운드 CPU를 상속한 뒤 메인 스레드를 포그라운드 CPU로 이동
+    pinForegroundThread(extra);
 
     // 랜덤 관련 초기화
     std::default_random_engine rng(std::random_device{}());
@@ -96,16 +104,80 @@ int main(int argc, char** argv) {
         }
     };
 
-    auto start = std::chrono::high_resolution_clock::now();
+    // 워크로드 모드: insert(삽입만, 기본) / churn(삽입 후 overwrite·delete 혼합)
+    std::string workload = getOption(extra, "workload", "insert");
+    bool churn = (workload == "churn");
+    int delete_pct = static_cast<int>(getOptionU64(extra, "delete_pct", 20));
+    int delete_range_pct = static_cast<int>(getOptionU64(extra, "delete_range_pct", 5));
+    int single_delete_pct = static_cast<int>(getOptionU64(extra, "single_delete_pct", 10));
+    if (churn && delete_pct + delete_range_pct + single_delete_pct > 100) {
+        std::cerr << "delete_pct + delete_range_pct + single_delete_pct는 100 이하여야 합니다" << std::endl;
+        return 1;
+    }
+    bool padded_keys = usePaddedKeys(extra);
 
-    // 데이터 삽입
-    for (int i = 0; i < num_keys; ++i) {
+    // SingleDelete는 한 번만 Put된 키에만 쓸 수 있고 Delete/DeleteRange와 섞어 쓰면 동작이 정의되지 않으므로
+    // 키별 상태를 추적
+    //   0 = 없음, 1 = 한 번 Put, 2 = 덮어씀
+    //   3 = Delete/DeleteRange로 삭제됨, 4 = 삭제 후 다시 Put (3, 4는 다시는 SingleDelete 대상이 아님)
+    enum : uint8_t { kAbsent = 0, kPutOnce = 1, kOverwritten = 2, kDeleted = 3, kDeletedThenPut = 4 };
+    std::vector<uint8_t> key_state(churn ? num_keys : 0, kAbsent);
+    auto mark_put = [&](int key) {
+        if (!churn) return;
+        uint8_t& state = key_state[key];
+        if (state == kAbsent) state = kPutOnce;
+        else if (state == kPutOnce) state = kOverwritten;
+        else if (state == kDeleted) state = kDeletedThenPut;
+    };
+    auto is_deleted = [&](int key) { return key_state[key] == kAbsent || key_state[key] == kDeleted; };
+
+    // 측정 중 힙 할당이 없도록 키 버퍼, 값, WriteOptions, WriteBatch를 미리 만들어 재사용
+    //   --check_alloc: 벤치마크 코드에서 할당이 발생하면 실패로 종료
+    bool check_alloc = getOptionBool(extra, "check_alloc", false);
+    char key_buf[16], range_end_buf[16];
+    std::string value(value_size, 'v');
+    rocksdb::Slice value_slice(value);
+    rocksdb::WriteOptions write_opts;
+    rocksdb::WriteBatch batch(value_size + 64);  // 헤더 + 키 + 값이 들어갈 크기로 예약
+    AllocStats put_allocs, churn_allocs;
+
+    auto put_random_key = [&]() {
+        uint64_t a0 = ThreadAllocCount();
         bool is_hot = (hot_access_dist(rng) < hot_ratio);
         int key = is_hot ? hot_key_dist(rng) : generate_cold_key(rng);
-        std::string key_str = std::to_string(key);
-        std::string value(value_size, 'v');
+        rocksdb::Slice key_slice = formatKeyTo(key_buf, key, padded_keys);
         auto* handle = is_hot ? handles[1] : handles[0];
-        db->Put(rocksdb::WriteOptions(), handle, key_str, value);
+        batch.Clear();
+        batch.Put(handle, key_slice, value_slice);
+        uint64_t a1 = ThreadAllocCount();
+        db->Write(write_opts, &batch);
+        mark_put(key);
+        put_allocs.harness += a1 - a0;
+        put_allocs.total += ThreadAllocCount() - a0;
+        put_allocs.ops++;
+    };
+
+    // 워밍업: 빈 DB에서 바로 측정하지 않도록 측정 전에 --warmup_ops 만큼 미리 삽입
+    uint64_t warmup_ops = getOptionU64(extra, "warmup_ops", 0);
+    for (uint64_t i = 0; i < warmup_ops; ++i) put_random_key();
+    put_allocs = AllocStats();
+
+    SteadyStateDetector detector(extra, statistics, db, handles);
+    detector.Start(num_keys);
+    CacheIoSnapshot io_before = takeCacheIoSnapshot(statistics);
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    // 데이터 삽입
+    for (int i = 0; i < num_keys; ++i) {
+        auto op_start = std::chrono::steady_clock::now();
+        put_random_key();
+        auto op_end = std::chrono::steady_clock::now();
+        // 지연 시간 기록도 측정 루프의 일부이므로 벤치마크 코드 할당에 포함
+        uint64_t r0 = ThreadAllocCount();
+        detector.Record(std::chrono::duration_cast<std::chrono::microseconds>(op_end - op_start).count());
+        put_allocs.harness += ThreadAllocCount() - r0;
+        put_allocs.total += ThreadAllocCount() - r0;
     }
 
     auto end = std::chrono::high_resolution_clock::now();
@@ -113,18 +185,123 @@ int main(int argc, char** argv) {
 
     std::cout << "워크로드 생성 완료!" << std::endl;
     std::cout << "총 소요시간: " << duration << "초\n";
+    if (warmup_ops > 0) std::cout << "워밍업 연산 수 (측정 제외): " << warmup_ops << std::endl;
+    detector.Report("쓰기");
+    printAllocSummary("쓰기", put_allocs, check_alloc);
+    printCacheIoBreakdown("쓰기", io_before, takeCacheIoSnapshot(statistics));
+
+    // churn 단계: overwrite / point delete / DeleteRange / SingleDelete 혼합
+    //   --churn_ops=1000000 --delete_pct=20 --delete_range_pct=5 --single_delete_pct=10
+    //   --delete_range_size=100 (나머지 비율은 overwrite)
+    if (churn) {
+        int churn_ops = static_cast<int>(getOptionU64(extra, "churn_ops", num_keys));
+        int range_size = static_cast<int>(getOptionU64(extra, "delete_range_size", 100));
+        size_t sample_limit = getOptionU64(extra, "deleted_read_samples", 10000);
+
+        uint64_t overwrites = 0, deletes = 0, range_deletes = 0, single_deletes = 0;
+        std::vector<int> deleted_keys, deleted_range_starts;  // 삭제 구간 읽기 측정용 샘플
+        deleted_keys.reserve(sample_limit);
+        deleted_range_starts.reserve(sample_limit);
+
+        auto churn_start = std::chrono::high_resolution_clock::now();
+
+        for (int i = 0; i < churn_ops; ++i) {
+            uint64_t a0 = ThreadAllocCount();
+            bool is_hot = (hot_access_dist(rng) < hot_ratio);
+            int key = is_hot ? hot_key_dist(rng) : generate_cold_key(rng);
+            rocksdb::Slice key_slice = formatKeyTo(key_buf, key, padded_keys);
+            auto* handle = is_hot ? handles[1] : handles[0];
+            int op = hot_access_dist(rng);
+            batch.Clear();
+
+            if (op < delete_range_pct) {
+                // hot/cold 영역 경계를 넘지 않도록 구간 끝을 제한
+                int limit = is_hot ? hot_end + 1 : (key < hot_start ? hot_start : num_keys);
+                int range_end = std::min(key + range_size, limit);
+                batch.DeleteRange(handle, key_slice, formatKeyTo(range_end_buf, range_end, padded_keys));
+                std::fill(key_state.begin() + key, key_state.begin() + range_end, kDeleted);
+                if (deleted_range_starts.size() < sample_limit) deleted_range_starts.push_back(key);
+                range_deletes++;
+            } else if (op < delete_range_pct + single_delete_pct && key_state[key] == kPutOnce) {
+                batch.SingleDelete(handle, key_slice);
+                key_state[key] = kAbsent;
+                if (deleted_keys.size() < sample_limit) deleted_keys.push_back(key);
+                single_deletes++;
+            } else if (op < delete_range_pct + single_delete_pct + delete_pct) {
+                // SingleDelete 대상이 한 번만 Put된 키가 아니면 일반 Delete로 대체
+                batch.Delete(handle, key_slice);
+                key_state[key] = kDeleted;
+                if (deleted_keys.size() < sample_limit) deleted_keys.push_back(key);
+                deletes++;
+            } else {
+                batch.Put(handle, key_slice, value_slice);
+                mark_put(key);
+                overwrites++;
+            }
+
+            uint64_t a1 = ThreadAllocCount();
+            db->Write(write_opts, &batch);
+            churn_allocs.harness += a1 - a0;
+            churn_allocs.total += ThreadAllocCount() - a0;
+            churn_allocs.ops++;
+        }
+
+        auto churn_end = std::chrono::high_resolution_clock::now();
+        double churn_duration =
+            std::chrono::duration_cast<std::chrono::milliseconds>(churn_end - churn_start).count() / 1000.0;
+
+        std::cout << "churn 소요시간: " << churn_duration << "초\n";
+        std::cout << "churn 연산 수 - overwrite: " << overwrites << ", delete: " << deletes
+                  << ", delete_range: " << range_deletes << ", single_delete: " << single_deletes << std::endl;
+        printAllocSummary("churn", churn_allocs, check_alloc);
+
+        // 삭제된 키에 대한 Get (tombstone을 지나야 NotFound 확인 가능)
+        rocksdb::ReadOptions churn_read_opts;
+        rocksdb::PinnableSlice pinned;
+        std::vector<uint64_t> deleted_get_lat, deleted_seek_lat;
+        for (int key : deleted_keys) {
+            if (!is_deleted(key)) continue;  // 이후 다시 Put된 키 제외
+            auto* handle = (key >= hot_start && key <= hot_end) ? handles[1] : handles[0];
+            pinned.Reset();
+            auto t0 = std::chrono::high_resolution_clock::now();
+            db->Get(churn_read_opts, handle, formatKeyTo(key_buf, key, padded_keys), &pinned);
+            auto t1 = std::chrono::high_resolution_clock::now();
+            deleted_get_lat.push_back(std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
+        }
+
+        // DeleteRange로 지운 구간 시작점에서 Seek (range tombstone을 건너뛰는 비용)
+        // iterator 생성 비용은 제외하고 Seek만 측정
+        std::unique_ptr<rocksdb::Iterator> hot_it(db->NewIterator(churn_read_opts, handles[1]));
+        std::unique_ptr<rocksdb::Iterator> cold_it(db->NewIterator(churn_read_opts, handles[0]));
+        for (int key : deleted_range_starts) {
+            if (!is_deleted(key)) continue;  // 이후 다시 Put되어 tombstone을 건너뛰지 않는 시작점 제외
+            auto& it = (key >= hot_start && key <= hot_end) ? hot_it : cold_it;
+            auto t0 = std::chrono::high_resolution_clock::now();
+            it->Seek(formatKeyTo(key_buf, key, padded_keys));
+            auto t1 = std::chrono::high_resolution_clock::now();
+            deleted_seek_lat.push_back(std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
+        }
+
+        printLatencySummary("삭제된 키 Get", deleted_get_lat);
+        printLatencySummary("삭제 구간 Seek", deleted_seek_lat);
+    }
 
     // 저장된 키 개수 카운팅
     uint64_t hot_count = 0, default_count = 0;
     rocksdb::ReadOptions read_opts;
+    rocksdb::PinnableSlice count_value;
 
     for (int i = 0; i < num_keys; ++i) {
-        std::string key_str = std::to_string(i);
-        std::string value;
+        rocksdb::Slice key_slice = formatKeyTo(key_buf, i, padded_keys);
 
-        if (db->Get(read_opts, handles[1], key_str, &value).ok()) {
+        // hot 컬럼 먼저 조회, 없으면 default 컬럼 조회 (PinnableSlice는 재사용 전 Reset)
+        count_value.Reset();
+        if (db->Get(read_opts, handles[1], key_slice, &count_value).ok()) {
             hot_count++;
-        } else if (db->Get(read_opts, handles[0], key_str, &value).ok()) {
+            continue;
+        }
+        count_value.Reset();
+        if (db->Get(read_opts, handles[0], key_slice, &count_value).ok()) {
             default_count++;
         }
     }
@@ -132,7 +309,18 @@ int main(int argc, char** argv) {
     std::cout << "hot 컬럼에 저장된 키 수: " << hot_count << std::endl;
     std::cout << "default 컬럼에 저장된 키 수: " << default_count << std::endl;
 
+    // tombstone / WAF 출력
+    printTombstoneSummary(db, handles[0], "default");
+    printTombstoneSummary(db, handles[1], "hot");
+    printCompactionDropSummary(statistics);
+    std::cout << "WAF: " << computeWriteAmp(statistics) << std::endl;
+    printSpaceAmp({{db, handles[0]}, {db, handles[1]}});
+
     // 통계 출력
+    printBuildInfo();
+    printCpuTopology(options, extra);
+    printIoOptions(options);
+    printCacheSummary(statistics);
     std::cout << "RocksDB 통계:\n" << statistics->ToString() << std::endl;
 
     for (auto* h : handles) db->DestroyColumnFamilyHandle(h);
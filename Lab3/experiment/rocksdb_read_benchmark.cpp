@@ -10,28 +10,19 @@
 #include <rocksdb/statistics.h>
 #include <cassert>
 #include <chrono>
+#include <algorithm>
+#include <memory>
+#include "bench_options.h"
+#include "thread_options.h"
+#include "steady_state.h"
+#include "alloc_counter.h"
+#include "io_options.h"
+#include "io_stats.h"
 
-rocksdb::CompactionStyle parseCompactionStyle(const std::string& style_str) {
-    if (style_str == "level") return rocksdb::kCompactionStyleLevel;
-    if (style_str == "universal") return rocksdb::kCompactionStyleUniversal;
-    if (style_str == "fifo") return rocksdb::kCompactionStyleFIFO;
-    if (style_str == "none") return rocksdb::kCompactionStyleNone;
-
-    std::cerr << "지원하지 않는 컴팩션 스타일입니다: " << style_str << std::endl;
-    exit(1);
-}
-
-rocksdb::CompressionType parseCompressionType(const std::string& comp_str) {
-    if (comp_str == "none") return rocksdb::kNoCompression;
-    if (comp_str == "Snappy") return rocksdb::kSnappyCompression;
-    if (comp_str == "Zlib") return rocksdb::kZlibCompression;
-    if (comp_str == "BZip2") return rocksdb::kBZip2Compression;
-    if (comp_str == "LZ4") return rocksdb::kLZ4Compression;
-    if (comp_str == "ZSTD") return rocksdb::kZSTD;
-
-    std::cerr << "지원하지 않는 압축 타입입니다: " << comp_str << std::endl;
-    exit(1);
-}
+// RocksDB(PosixFileSystem)는 이 weak 심볼로 io_uring 사용 여부를 확인한다 (db_bench의 --io_uring_enabled와 같은 방식)
+// 심볼이 없던 기존 실행과 같도록 기본은 꺼 두고, --io_uring=true 또는 async 모드에서만 켠다
+static bool g_io_uring_enabled = false;
+extern "C" bool RocksDbIOUringEnable() { return g_io_uring_enabled; }
 
 int generate_cold_key(std::default_random_engine& rng, int hot_start, int hot_end, int num_keys) {
     std::uniform_int_distribution<int> dist(0, num_keys - 1);
@@ -46,7 +37,8 @@ int main(int argc, char** argv) {
     if (argc < 11) {
         std::cerr << "사용법: " << argv[0]
                   << " <DB 경로> <총 키 수> <핫 범위 시작> <핫 범위 끝> <value 크기> <핫 접근 비율(0~100)>"
-                  << " <default compaction> <hot compaction> <default compression> <hot compression>" << std::endl;
+                  << " <default compaction> <hot compaction> <default compression> <hot compression>"
+                  << " [--key=value ...]" << std::endl;
         return 1;
     }
 
@@ -60,19 +52,48 @@ int main(int argc, char** argv) {
     std::string hot_compaction_str = argv[8];
     std::string default_compression_str = argv[9];
     std::string hot_compression_str = argv[10];
+    ExtraOptions extra = parseExtraOptions(argc, argv, 11);
+
+    // cold CF 비동기 읽기 경로
+    //   --cold_io_mode=async  cold CF 읽기에 ReadOptions::async_io 사용
+    //   --queue_depth=8       cold 키를 queue_depth개씩 모아 MultiGet (스레드당 동시 I/O 수)
+    //   --io_uring=true       io_uring 사용 (기본: async 모드에서만 켬, RocksDB가 liburing과 함께 빌드된 경우에만 의미 있음)
+    // PosixFileSystem은 파일을 열 때 io_uring 사용 여부를 읽어 두고, 기존 SST는 DB::Open에서 모두 열리므로
+    // io_uring 플래그는 DB 오픈 전에 정해야 한다
+    std::string cold_io_mode = getOption(extra, "cold_io_mode", "sync");
+    if (cold_io_mode != "sync" && cold_io_mode != "async") {
+        std::cerr << "지원하지 않는 cold_io_mode: " << cold_io_mode << " (sync / async)" << std::endl;
+        return 1;
+    }
+    bool cold_async = (cold_io_mode == "async");
+    g_io_uring_enabled = getOptionBool(extra, "io_uring", cold_async);
 
     rocksdb::Options options;
     options.create_if_missing = false;
     options.create_missing_column_families = true;
     options.statistics = rocksdb::CreateDBStatistics();
 
+    // 백그라운드 job / 스레드 풀 크기 및 CPU 고정
+    applyThreadOptions(options, extra);
+
+    // Direct-I/O / mmap, readahead, bytes_per_sync, rate limiter
+    applyIoOptions(options, extra);
+
     rocksdb::ColumnFamilyOptions default_cf_options;
     default_cf_options.compaction_style = parseCompactionStyle(default_compaction_str);
     default_cf_options.compression = parseCompressionType(default_compression_str);
+    applyCompressionOptions(default_cf_options, extra, "default");
+    applyLevelOptions(default_cf_options, extra, "default");
 
     rocksdb::ColumnFamilyOptions hot_cf_options;
     hot_cf_options.compaction_style = parseCompactionStyle(hot_compaction_str);
     hot_cf_options.compression = parseCompressionType(hot_compression_str);
+    applyCompressionOptions(hot_cf_options, extra, "hot");
+    applyLevelOptions(hot_cf_options, extra, "hot");
+
+    auto block_cache = makeBlockCache(extra);
+    applyTableOptions(default_cf_options, block_cache);
+    applyTableOptions(hot_cf_options, block_cache);
 
     std::vector<rocksdb::ColumnFamilyDescriptor> cf_descriptors = {
         rocksdb::ColumnFamilyDescriptor("default", default_cf_options),
@@ -82,42 +103,205 @@ int main(int argc, char** argv) {
     std::vector<rocksdb::ColumnFamilyHandle*> handles;
     rocksdb::DB* db;
     auto status = rocksdb::DB::Open(options, db_path, cf_descriptors, &handles, &db);
-    assert(status.ok());
+    if (!status.ok()) {
+        std::cerr << "DB 오픈 실패: " << status.ToString() << std::endl;
+        return 1;
+    }
+    // 벤치마크 스레드는 DB 오픈 후 포그라운드 CPU로
+    pinForegroundThread(extra);
 
     std::default_random_engine rng(std::random_device{}());
     std::uniform_int_distribution<int> hot_key_dist(hot_start, hot_end);
     std::uniform_int_distribution<int> hot_access_dist(0, 99);
 
     int found_hot = 0, found_default = 0;
+    bool padded_keys = usePaddedKeys(extra);  // 쓰기 벤치마크와 같은 키 형식 사용
 
-    auto start = std::chrono::high_resolution_clock::now();
+    // 측정 중 힙 할당이 없도록 키 버퍼와 ReadOptions를 재사용하고,
+    // 값은 std::string으로 복사하지 않고 PinnableSlice로 블록 캐시에 고정해서 읽는다
+    bool check_alloc = getOptionBool(extra, "check_alloc", false);
+    char key_buf[16];
+    rocksdb::ReadOptions read_opts;
+    rocksdb::PinnableSlice value;
+    AllocStats get_allocs;
+
+    // cold 키 MultiGet 배치 (옵션 설명은 위 cold_io_mode 참고)
+    size_t queue_depth = std::max<uint64_t>(1, getOptionU64(extra, "queue_depth", 1));
+    bool use_multiget = cold_async || queue_depth > 1;
+
+    rocksdb::ReadOptions cold_read_opts;
+    cold_read_opts.async_io = cold_async;
+    cold_read_opts.optimize_multiget_for_io = cold_async;
+
+    std::vector<char> cold_key_bufs(queue_depth * 16);
+    std::vector<rocksdb::Slice> cold_keys(queue_depth);
+    std::vector<rocksdb::PinnableSlice> cold_values(queue_depth);
+    std::vector<rocksdb::Status> cold_statuses(queue_depth);
+    size_t cold_pending = 0;
+
+    bool measuring = false;
+    std::vector<uint64_t> hot_lat, cold_lat;
+    hot_lat.reserve(num_keys);
+    cold_lat.reserve(num_keys);
+
+    SteadyStateDetector detector(extra, options.statistics, db, handles);
+
+    auto record = [&](bool is_hot_access, bool found, uint64_t latency_us) {
+        if (!measuring) return;
+        uint64_t r0 = ThreadAllocCount();
+        detector.Record(latency_us);
+        (is_hot_access ? hot_lat : cold_lat).push_back(latency_us);
+        if (found) {
+            is_hot_access ? found_hot++ : found_default++;
+        }
+        get_allocs.harness += ThreadAllocCount() - r0;
+        get_allocs.total += ThreadAllocCount() - r0;
+    };
+
+    // 모아둔 cold 키를 MultiGet 한 번으로 읽음. 배치 안의 키는 배치 완료 시간을 지연 시간으로 가진다
+    auto flush_cold_batch = [&]() {
+        if (cold_pending == 0) return;
+        uint64_t a0 = ThreadAllocCount();
+        auto t0 = std::chrono::steady_clock::now();
+        db->MultiGet(cold_read_opts, handles[0], cold_pending, cold_keys.data(),
+                     cold_values.data(), cold_statuses.data());
+        auto t1 = std::chrono::steady_clock::now();
+        get_allocs.total += ThreadAllocCount() - a0;
+        uint64_t latency_us = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+        for (size_t k = 0; k < cold_pending; ++k) {
+            record(false, cold_statuses[k].ok(), latency_us);
+            cold_values[k].Reset();
+        }
+        cold_pending = 0;
+    };
 
-    for (int i = 0; i < num_keys; ++i) {
+    // 키 하나를 읽음 (cold 키는 MultiGet 모드이면 배치에 넣고 배치가 차면 한 번에 읽음)
+    auto get_random_key = [&]() {
+        uint64_t a0 = ThreadAllocCount();
         bool is_hot_access = (hot_access_dist(rng) < hot_ratio);
 
         int key = is_hot_access
                     ? hot_key_dist(rng)
                     : generate_cold_key(rng, hot_start, hot_end, num_keys);
 
-        std::string key_str = std::to_string(key);
-        std::string value;
+        if (!is_hot_access && use_multiget) {
+            cold_keys[cold_pending] = formatKeyTo(&cold_key_bufs[cold_pending * 16], key, padded_keys);
+            cold_pending++;
+            get_allocs.harness += ThreadAllocCount() - a0;
+            get_allocs.total += ThreadAllocCount() - a0;
+            get_allocs.ops++;
+            if (cold_pending == queue_depth) flush_cold_batch();
+            return;
+        }
+
+        rocksdb::Slice key_slice = formatKeyTo(key_buf, key, padded_keys);
+        value.Reset();
 
         rocksdb::ColumnFamilyHandle* target_handle = is_hot_access ? handles[1] : handles[0];
+        const rocksdb::ReadOptions& opts = is_hot_access ? read_opts : cold_read_opts;
 
-        rocksdb::Status s = db->Get(rocksdb::ReadOptions(), target_handle, key_str, &value);
-        if (s.ok()) {
-            is_hot_access ? found_hot++ : found_default++;
-        }
-    }
+        uint64_t a1 = ThreadAllocCount();
+        auto t0 = std::chrono::steady_clock::now();
+        rocksdb::Status s = db->Get(opts, target_handle, key_slice, &value);
+        auto t1 = std::chrono::steady_clock::now();
+        get_allocs.harness += a1 - a0;
+        get_allocs.total += ThreadAllocCount() - a0;
+        get_allocs.ops++;
+        record(is_hot_access, s.ok(),
+               std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
+    };
+
+    // 워밍업: 차가운 캐시에서 바로 측정하지 않도록 --warmup_ops 만큼 미리 읽기
+    uint64_t warmup_ops = getOptionU64(extra, "warmup_ops", 0);
+    for (uint64_t i = 0; i < warmup_ops; ++i) get_random_key();
+    flush_cold_batch();
+    get_allocs = AllocStats();
+
+    std::string device_stat_path = deviceStatPath(db_path);
+    DeviceStats dev_before, dev_after;
+    readDeviceStats(device_stat_path, &dev_before);
+    uint64_t sst_reads_before = sstReadCount(options.statistics);
+    CacheIoSnapshot io_before = takeCacheIoSnapshot(options.statistics);
+
+    measuring = true;
+    detector.Start(num_keys);
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < num_keys; ++i) get_random_key();
+    flush_cold_batch();
 
     auto end = std::chrono::high_resolution_clock::now();
     double duration_sec = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() / 1000.0;
+    measuring = false;
 
     std::cout << "읽기 벤치마크 완료!" << std::endl;
     std::cout << "총 소요시간: " << duration_sec << "초" << std::endl;
     std::cout << "hot 컬럼에서 찾은 키 수: " << found_hot << std::endl;
     std::cout << "default 컬럼에서 찾은 키 수: " << found_default << std::endl;
+    if (warmup_ops > 0) std::cout << "워밍업 연산 수 (측정 제외): " << warmup_ops << std::endl;
+    detector.Report("읽기");
+    printAllocSummary("읽기", get_allocs, check_alloc);
+
+    // cold 읽기 경로 I/O 지표 (sync / async 비교용)
+    std::cout << "\ncold 읽기 모드: " << (cold_async ? "async" : "sync")
+              << ", queue depth: " << queue_depth
+              << ", io_uring: " << (g_io_uring_enabled ? "on" : "off") << std::endl;
+    printAsyncMultiGetSupport(options.statistics, cold_async);
+    printLatencySummary("hot Get", hot_lat);
+    printLatencySummary("cold Get", cold_lat);
+    if (duration_sec > 0) {
+        std::cout << "RocksDB SST 읽기 IOPS: "
+                  << (sstReadCount(options.statistics) - sst_reads_before) / duration_sec << std::endl;
+    }
+    if (readDeviceStats(device_stat_path, &dev_after)) {
+        printDeviceStatsDelta("읽기", dev_before, dev_after, duration_sec);
+    } else {
+        std::cout << "디바이스 통계를 읽을 수 없음 (블록 디바이스가 아닌 경로)" << std::endl;
+    }
+    printCacheIoBreakdown("읽기", io_before, takeCacheIoSnapshot(options.statistics));
+
+    // cold CF 범위 스캔: iterator prefetch (async 모드에서는 async_io + adaptive readahead)
+    //   --cold_scan_ops=1000 --scan_length=100 --cold_readahead_kb=256
+    uint64_t scan_ops = getOptionU64(extra, "cold_scan_ops", 0);
+    if (scan_ops > 0) {
+        int scan_length = static_cast<int>(getOptionU64(extra, "scan_length", 100));
+        rocksdb::ReadOptions scan_opts;
+        scan_opts.async_io = cold_async;
+        scan_opts.adaptive_readahead = cold_async;
+        scan_opts.readahead_size = getOptionU64(extra, "cold_readahead_kb", 0) << 10;
+
+        std::vector<uint64_t> scan_lat;
+        scan_lat.reserve(scan_ops);
+        uint64_t scanned = 0;
+        readDeviceStats(device_stat_path, &dev_before);
+        io_before = takeCacheIoSnapshot(options.statistics);
+        std::unique_ptr<rocksdb::Iterator> it(db->NewIterator(scan_opts, handles[0]));
+
+        auto scan_start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < scan_ops; ++i) {
+            int key = generate_cold_key(rng, hot_start, hot_end, num_keys);
+            auto t0 = std::chrono::steady_clock::now();
+            it->Seek(formatKeyTo(key_buf, key, padded_keys));
+            for (int n = 0; n < scan_length && it->Valid(); ++n, it->Next()) scanned++;
+            auto t1 = std::chrono::steady_clock::now();
+            scan_lat.push_back(std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
+        }
+        double scan_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - scan_start).count();
+
+        std::cout << "cold 스캔 - " << scan_ops << "회, 읽은 키 수: " << scanned
+                  << ", " << scanned / scan_sec << " keys/s" << std::endl;
+        printLatencySummary("cold 스캔", scan_lat);
+        if (readDeviceStats(device_stat_path, &dev_after)) {
+            printDeviceStatsDelta("스캔", dev_before, dev_after, scan_sec);
+        }
+        printCacheIoBreakdown("스캔", io_before, takeCacheIoSnapshot(options.statistics));
+    }
 
+    printBuildInfo();
+    printCpuTopology(options, extra);
+    printIoOptions(options);
+    printCacheSummary(options.statistics);
     std::cout << "RocksDB 통계:\n" << options.statistics->ToString() << std::endl;
 
     for (auto* h : handles) db->DestroyColumnFamilyHandle(h);
@@ -0,0 +1,332 @@
+// hot/cold 하니스를 N개 shard로 일반화한 버전
+// shard 모드 cf: 하나의 DB 안에 N개의 Column Family
+// shard 모드 db: N개의 DB 인스턴스 (Env 스레드 풀 / 블록 캐시 / 통계 공유)
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <rocksdb/db.h>
+#include <rocksdb/env.h>
+#include <rocksdb/options.h>
+#include <rocksdb/slice.h>
+#include <rocksdb/statistics.h>
+#include <rocksdb/write_batch.h>
+#include <cassert>
+#include <chrono>
+#include "bench_options.h"
+#include "thread_options.h"
+#include "io_options.h"
+#include "io_stats.h"
+#include "alloc_counter.h"
+
+struct Shard {
+    rocksdb::DB* db;
+    rocksdb::ColumnFamilyHandle* handle;
+};
+
+// 키를 shard 번호로 라우팅 (hash: 곱셈 해시, range: 연속 구간 분할)
+// 곱셈 해시는 상위 비트가 잘 섞이므로 h % N 대신 상위 비트로 [0, N) 범위에 매핑
+// (N이 2의 거듭제곱이면 h % N은 key % N의 순열에 불과함)
+int routeKey(int key, int num_keys, int num_shards, bool hash_routing) {
+    if (hash_routing) {
+        uint32_t h = static_cast<uint32_t>(key) * 2654435761u;
+        return static_cast<int>((static_cast<uint64_t>(h) * num_shards) >> 32);
+    }
+    int range = (num_keys + num_shards - 1) / num_shards;
+    return key / range;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 9) {
+        std::cerr << "사용법: " << argv[0]
+                  << " <DB 경로> <총 키 수> <value 크기> <shard 수> <shard 모드(cf|db)> <라우팅(hash|range)>"
+                  << " <compaction> <compression> [--key=value ...]\n"
+                  << "  shard별 옵션은 --shard<i>.compaction=level / --shard<i>.compression=LZ4 처럼 지정\n"
+                  << "  hot 구간과 hot 접근 비율은 --hot_start=0 --hot_end=199999 --hot_ratio=70 (기본: 앞 20% 키, 70%)\n";
+        return 1;
+    }
+
+    // 인자 파싱
+    std::string db_path = argv[1];
+    int num_keys = std::stoi(argv[2]);
+    int value_size = std::stoi(argv[3]);
+    int num_shards = std::stoi(argv[4]);
+    std::string shard_mode = argv[5];
+    std::string routing = argv[6];
+    std::string compaction_str = argv[7];
+    std::string compression_str = argv[8];
+    ExtraOptions extra = parseExtraOptions(argc, argv, 9);
+
+    if (shard_mode != "cf" && shard_mode != "db") {
+        std::cerr << "지원하지 않는 shard 모드: " << shard_mode << std::endl;
+        return 1;
+    }
+    if (routing != "hash" && routing != "range") {
+        std::cerr << "지원하지 않는 라우팅: " << routing << " (hash / range)" << std::endl;
+        return 1;
+    }
+    bool hash_routing = (routing == "hash");
+    int num_threads = static_cast<int>(getOptionU64(extra, "threads", 1));
+
+    // hot/cold 접근 분포는 두 CF 하니스와 같은 방식 (hot 구간에서 hot_ratio%, 나머지는 cold 구간)
+    int hot_start = static_cast<int>(getOptionU64(extra, "hot_start", 0));
+    int hot_end = static_cast<int>(getOptionU64(extra, "hot_end", num_keys / 5 - 1));
+    int hot_ratio = static_cast<int>(getOptionU64(extra, "hot_ratio", 70));
+
+    if (num_keys <= 0 || num_shards <= 0 || num_threads <= 0) {
+        std::cerr << "총 키 수, shard 수, --threads는 1 이상이어야 합니다" << std::endl;
+        return 1;
+    }
+    if (hot_start > hot_end || hot_end >= num_keys || hot_ratio > 100) {
+        std::cerr << "hot 구간은 0 <= hot_start <= hot_end < 총 키 수, hot_ratio는 0~100이어야 합니다" << std::endl;
+        return 1;
+    }
+    if (hot_ratio < 100 && hot_start == 0 && hot_end == num_keys - 1) {
+        std::cerr << "hot 구간이 전체 키를 덮어 cold 키를 만들 수 없습니다" << std::endl;
+        return 1;
+    }
+
+    // DB 옵션 설정 (모든 shard가 같은 Env / 통계 객체 사용)
+    rocksdb::Options options;
+    options.create_if_missing = true;
+    options.create_missing_column_families = true;
+    options.env = rocksdb::Env::Default();
+
+    std::shared_ptr<rocksdb::Statistics> statistics = rocksdb::CreateDBStatistics();
+    options.statistics = statistics;
+
+    // 백그라운드 job / 스레드 풀 크기 및 CPU 고정
+    applyThreadOptions(options, extra);
+
+    // Direct-I/O / mmap, readahead, bytes_per_sync, rate limiter (rate limiter는 모든 shard가 공유)
+    applyIoOptions(options, extra);
+
+    // 블록 캐시는 옵션이 없어도 shard 간에 하나를 공유
+    auto block_cache = makeBlockCache(extra);
+    if (!block_cache) block_cache = rocksdb::NewLRUCache(32 << 20);
+
+    // shard별 CF 옵션: 기본 인자 + --shard<i>.* 덮어쓰기
+    std::vector<rocksdb::ColumnFamilyOptions> shard_cf_options(num_shards);
+    for (int i = 0; i < num_shards; ++i) {
+        std::string prefix = "shard" + std::to_string(i);
+        auto& cf_options = shard_cf_options[i];
+        cf_options.compaction_style =
+            parseCompactionStyle(getOption(extra, "compaction", compaction_str, prefix));
+        cf_options.compression =
+            parseCompressionType(getOption(extra, "compression", compression_str, prefix));
+        applyCompressionOptions(cf_options, extra, prefix);
+        applyLevelOptions(cf_options, extra, prefix);
+        applyTableOptions(cf_options, block_cache);
+    }
+
+    // DB 오픈
+    std::vector<rocksdb::DB*> dbs;
+    std::vector<rocksdb::ColumnFamilyHandle*> handles;
+    std::vector<Shard> shards;
+
+    if (shard_mode == "cf") {
+        // max_subcompactions는 DB 옵션이라 CF 단위 shard에는 지정할 수 없음
+        for (int i = 0; i < num_shards; ++i) {
+            std::string key = "shard" + std::to_string(i) + ".max_subcompactions";
+            if (extra.count(key)) {
+                std::cerr << "--" << key << "는 db 모드에서만 지원됩니다 (cf 모드는 --max_subcompactions 사용)"
+                          << std::endl;
+                return 1;
+            }
+        }
+
+        // shard0은 default CF, 나머지는 shard<i> CF
+        std::vector<rocksdb::ColumnFamilyDescriptor> cf_descriptors;
+        for (int i = 0; i < num_shards; ++i) {
+            std::string name = (i == 0) ? rocksdb::kDefaultColumnFamilyName : "shard" + std::to_string(i);
+            cf_descriptors.emplace_back(name, shard_cf_options[i]);
+        }
+        rocksdb::DB* db;
+        auto status = rocksdb::DB::Open(options, db_path, cf_descriptors, &handles, &db);
+        if (!status.ok()) {
+            std::cerr << "DB 오픈 실패: " << status.ToString() << std::endl;
+            return 1;
+        }
+        dbs.push_back(db);
+        for (auto* h : handles) shards.push_back({db, h});
+    } else {
+        options.env->CreateDirIfMissing(db_path);  // shard DB들의 상위 디렉토리
+        for (int i = 0; i < num_shards; ++i) {
+            std::vector<rocksdb::ColumnFamilyDescriptor> cf_descriptors = {
+                rocksdb::ColumnFamilyDescriptor(rocksdb::kDefaultColumnFamilyName, shard_cf_options[i])
+            };
+            // DB 단위 shard는 서브 컴팩션 수를 shard별로 지정 가능 (--shard<i>.max_subcompactions)
+            rocksdb::Options shard_options = options;
+            shard_options.max_subcompactions = static_cast<uint32_t>(getOptionU64(
+                extra, "max_subcompactions", options.max_subcompactions, "shard" + std::to_string(i)));
+            std::vector<rocksdb::ColumnFamilyHandle*> shard_handles;
+            rocksdb::DB* db;
+            auto status = rocksdb::DB::Open(shard_options, db_path + "/shard" + std::to_string(i),
+                                            cf_descriptors, &shard_handles, &db);
+            if (!status.ok()) {
+                std::cerr << "DB 오픈 실패: " << status.ToString() << std::endl;
+                return 1;
+            }
+            dbs.push_back(db);
+            handles.push_back(shard_handles[0]);
+            shards.push_back({db, shard_handles[0]});
+        }
+    }
+
+    // 모든 shard 오픈이 끝난 뒤 포그라운드 CPU로 이동
+    pinForegroundThread(extra);
+
+    // compaction 간섭 측정: 1초마다 실행 중인 compaction 수와 pending 바이트를 샘플링
+    std::atomic<bool> sampling(true);
+    uint64_t max_running_compactions = 0, max_pending_bytes = 0;
+    std::thread sampler([&]() {
+        while (sampling.load()) {
+            uint64_t running = 0, pending = 0;
+            for (auto& shard : shards) {
+                uint64_t v = 0;
+                if (shard.db->GetIntProperty(shard.handle, "rocksdb.estimate-pending-compaction-bytes", &v))
+                    pending += v;
+            }
+            for (auto* db : dbs) {
+                uint64_t v = 0;
+                if (db->GetIntProperty("rocksdb.num-running-compactions", &v)) running += v;
+            }
+            max_running_compactions = std::max(max_running_compactions, running);
+            max_pending_bytes = std::max(max_pending_bytes, pending);
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+        }
+    });
+
+    // 쓰기/읽기 단계를 num_threads개 스레드로 나누어 실행
+    //   --check_alloc: 측정 루프의 벤치마크 코드에서 힙 할당이 발생하면 실패로 종료
+    bool check_alloc = getOptionBool(extra, "check_alloc", false);
+    std::atomic<uint64_t> hot_ops(0);
+    auto run_phase = [&](bool is_write, AllocStats* allocs) {
+        std::vector<std::thread> workers;
+        std::atomic<uint64_t> found(0);
+        std::vector<AllocStats> thread_allocs(num_threads);  // 스레드별로 세고 끝난 뒤 합산
+        int ops_per_thread = num_keys / num_threads;
+        for (int t = 0; t < num_threads; ++t) {
+            workers.emplace_back([&, t]() {
+                std::default_random_engine rng(std::random_device{}() + t);
+                std::uniform_int_distribution<int> hot_key_dist(hot_start, hot_end);
+                std::uniform_int_distribution<int> any_key_dist(0, num_keys - 1);
+                std::uniform_int_distribution<int> hot_access_dist(0, 99);
+                auto next_key = [&](bool is_hot) {
+                    if (is_hot) return hot_key_dist(rng);
+                    while (true) {
+                        int k = any_key_dist(rng);
+                        if (k < hot_start || k > hot_end) return k;
+                    }
+                };
+                uint64_t local_found = 0, local_hot = 0;
+
+                // 스레드별 키 버퍼 / 값 / 옵션 / WriteBatch를 재사용해 연산마다 힙 할당이 없도록 함
+                // (DB::Put은 호출마다 내부에서 WriteBatch를 새로 만든다)
+                char key_buf[16];
+                std::string value(is_write ? value_size : 0, 'v');
+                rocksdb::Slice value_slice(value);
+                rocksdb::WriteOptions write_opts;
+                rocksdb::ReadOptions read_opts;
+                rocksdb::PinnableSlice pinned;
+                rocksdb::WriteBatch batch(is_write ? value_size + 64 : 0);
+                AllocStats& local_allocs = thread_allocs[t];
+
+                for (int i = 0; i < ops_per_thread; ++i) {
+                    uint64_t a0 = ThreadAllocCount();
+                    bool is_hot = (hot_access_dist(rng) < hot_ratio);
+                    int key = next_key(is_hot);
+                    local_hot += is_hot;
+                    auto& shard = shards[routeKey(key, num_keys, num_shards, hash_routing)];
+                    rocksdb::Slice key_slice = formatKeyTo(key_buf, key, false);
+                    if (is_write) {
+                        batch.Clear();
+                        batch.Put(shard.handle, key_slice, value_slice);
+                        uint64_t a1 = ThreadAllocCount();
+                        shard.db->Write(write_opts, &batch);
+                        local_allocs.harness += a1 - a0;
+                    } else {
+                        pinned.Reset();
+                        uint64_t a1 = ThreadAllocCount();
+                        if (shard.db->Get(read_opts, shard.handle, key_slice, &pinned).ok())
+                            local_found++;
+                        local_allocs.harness += a1 - a0;
+                    }
+                    local_allocs.total += ThreadAllocCount() - a0;
+                    local_allocs.ops++;
+                }
+                found += local_found;
+                hot_ops += local_hot;
+            });
+        }
+        for (auto& w : workers) w.join();
+        for (const auto& a : thread_allocs) {
+            allocs->harness += a.harness;
+            allocs->total += a.total;
+            allocs->ops += a.ops;
+        }
+        return found.load();
+    };
+    AllocStats write_allocs, read_allocs;
+
+    CacheIoSnapshot io_write_start = takeCacheIoSnapshot(statistics);
+    auto start = std::chrono::high_resolution_clock::now();
+    run_phase(true, &write_allocs);
+    auto end = std::chrono::high_resolution_clock::now();
+    double write_sec = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() / 1000.0;
+
+    CacheIoSnapshot io_read_start = takeCacheIoSnapshot(statistics);
+    start = std::chrono::high_resolution_clock::now();
+    uint64_t found = run_phase(false, &read_allocs);
+    end = std::chrono::high_resolution_clock::now();
+    CacheIoSnapshot io_read_end = takeCacheIoSnapshot(statistics);
+    double read_sec = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() / 1000.0;
+
+    sampling = false;
+    sampler.join();
+
+    uint64_t total_ops = static_cast<uint64_t>(num_keys / num_threads) * num_threads;
+    std::cout << "shard 벤치마크 완료!" << std::endl;
+    std::cout << "shard 수: " << num_shards << " (" << shard_mode << ", " << routing << ")"
+              << ", 스레드 수: " << num_threads
+              << ", 코어 수: " << std::thread::hardware_concurrency() << std::endl;
+    std::cout << "쓰기 소요시간: " << write_sec << "초, 처리량: " << total_ops / write_sec << " ops/s" << std::endl;
+    std::cout << "읽기 소요시간: " << read_sec << "초, 처리량: " << total_ops / read_sec << " ops/s"
+              << ", 찾은 키 수: " << found << std::endl;
+    std::cout << "hot 구간: " << hot_start << "~" << hot_end << ", hot 접근 비율: " << hot_ratio
+              << "%, 실제 hot 연산 수: " << hot_ops.load() << " / " << total_ops * 2 << std::endl;
+    printAllocSummary("쓰기", write_allocs, check_alloc);
+    printAllocSummary("읽기", read_allocs, check_alloc);
+    printCacheIoBreakdown("쓰기", io_write_start, io_read_start);
+    printCacheIoBreakdown("읽기", io_read_start, io_read_end);
+
+    // compaction 간섭 지표
+    std::cout << "최대 동시 compaction 수: " << max_running_compactions << std::endl;
+    std::cout << "최대 pending compaction 바이트: " << max_pending_bytes << std::endl;
+    std::cout << "write stall 시간(us): " << statistics->getTickerCount(rocksdb::STALL_MICROS) << std::endl;
+    std::cout << "WAF: " << computeWriteAmp(statistics) << std::endl;
+    std::vector<std::pair<rocksdb::DB*, rocksdb::ColumnFamilyHandle*>> shard_cfs;
+    for (auto& shard : shards) shard_cfs.emplace_back(shard.db, shard.handle);
+    printSpaceAmp(shard_cfs);
+
+    // shard별 데이터 분포
+    for (int i = 0; i < num_shards; ++i) {
+        uint64_t num_entries = 0, sst_size = 0;
+        shards[i].db->GetIntProperty(shards[i].handle, "rocksdb.estimate-num-keys", &num_entries);
+        shards[i].db->GetIntProperty(shards[i].handle, "rocksdb.total-sst-files-size", &sst_size);
+        std::cout << "shard" << i << " - 추정 키 수: " << num_entries << ", SST 크기: " << sst_size << std::endl;
+    }
+
+    // 통계 출력
+    printBuildInfo();
+    printCpuTopology(options, extra);
+    printIoOptions(options);
+    printCacheSummary(statistics);
+    std::cout << "RocksDB 통계:\n" << statistics->ToString() << std::endl;
+
+    for (size_t i = 0; i < shards.size(); ++i) shards[i].db->DestroyColumnFamilyHandle(shards[i].handle);
+    for (auto* db : dbs) delete db;
+    return 0;
+}
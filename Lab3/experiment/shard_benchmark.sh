@@ -0,0 +1,52 @@
+#!/bin/bash
+
+DB_PATH="./mydb"
+LOG_DIR="./exp_log_shard"
+NUM_KEYS=1000000
+HOT_START=0
+HOT_END=199999
+VALUE_SIZE=$((16 * 1024))  # 16KB
+HOT_RATIO=70
+
+mkdir -p "$LOG_DIR"
+
+# 실행 파일
+EXEC="./rocksdb_shard_benchmark"
+
+# 고정된 컴팩션 / 압축 방식
+COMPACTION="level"
+COMPRESSION="LZ4"
+
+# 실험 축: shard 수 × 스레드 수 × shard 모드
+SHARD_COUNTS=(1 2 4 8 16)
+THREAD_COUNTS=(1 4 8 16)
+SHARD_MODES=(cf db)
+ROUTING="hash"
+
+# 실험 반복 횟수
+NUM_RUNS=3
+
+for ((run=1; run<=NUM_RUNS; run++)); do
+    for MODE in "${SHARD_MODES[@]}"; do
+        for SHARDS in "${SHARD_COUNTS[@]}"; do
+            for THREADS in "${THREAD_COUNTS[@]}"; do
+                LOG_FILE="$LOG_DIR/shard_${MODE}_n${SHARDS}_t${THREADS}_run${run}.log"
+
+                echo "실험 시작: mode=$MODE, shards=$SHARDS, threads=$THREADS (반복 $run)"
+                echo "→ 로그: $LOG_FILE"
+
+                rm -rf "$DB_PATH"
+
+                "$EXEC" "$DB_PATH" "$NUM_KEYS" "$VALUE_SIZE" "$SHARDS" "$MODE" "$ROUTING" \
+                    "$COMPACTION" "$COMPRESSION" --threads="$THREADS" --block_cache_mb=256 \
+                    --hot_start=$HOT_START --hot_end=$HOT_END --hot_ratio=$HOT_RATIO \
+                    > "$LOG_FILE" 2>&1
+
+                echo "완료됨: $LOG_FILE"
+                echo "-------------------------------"
+            done
+        done
+    done
+done
+
+echo "모든 실험 완료 ✅"
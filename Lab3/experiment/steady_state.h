@@ -0,0 +1,209 @@
+// 윈도우 단위 처리량/지연 시간 분산으로 steady state를 감지하고
+// 안정 구간에 대해서만 지표를 계산하는 도우미
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <rocksdb/db.h>
+#include <rocksdb/statistics.h>
+#include "bench_options.h"
+
+// 판정 조건 (최근 steady_windows개 윈도우 기준)
+//   --window_ops=10000       윈도우 하나의 연산 수
+//   --steady_windows=5       연속으로 안정적이어야 하는 윈도우 수
+//   --steady_cv=0.1          처리량 / 평균 지연 시간의 변동계수 상한
+//   --steady_hit_delta=0.02  블록 캐시 hit율 변화 폭 상한
+//   pending compaction 바이트가 같은 비율 이상으로 계속 증가하지 않을 것
+// Record()는 측정 루프 안에서 불리므로 힙 할당이 없어야 한다
+//   - 기록용 벡터는 Start()에서 미리 예약하고, 판정은 windows_ 위에서 바로 계산
+//   - GetIntProperty는 내부에서 속성 이름 문자열을 만들므로 별도 샘플러 스레드가 읽어 둔다
+class SteadyStateDetector {
+public:
+    SteadyStateDetector(const ExtraOptions& opts, std::shared_ptr<rocksdb::Statistics> statistics,
+                        rocksdb::DB* db, std::vector<rocksdb::ColumnFamilyHandle*> handles)
+        : statistics_(statistics), db_(db), handles_(handles) {
+        window_ops_ = std::max<uint64_t>(1, getOptionU64(opts, "window_ops", 10000));
+        steady_windows_ = std::max<uint64_t>(2, getOptionU64(opts, "steady_windows", 5));
+        steady_cv_ = std::stod(getOption(opts, "steady_cv", "0.1"));
+        steady_hit_delta_ = std::stod(getOption(opts, "steady_hit_delta", "0.02"));
+    }
+
+    ~SteadyStateDetector() { StopSampler(); }
+
+    // 측정 시작 (워밍업이 끝난 직후 호출)
+    // expected_ops만큼 미리 공간을 잡아 측정 중 기록용 벡터가 재할당되지 않게 한다
+    void Start(size_t expected_ops = 0) {
+        start_ = std::chrono::steady_clock::now();
+        window_start_ = start_;
+        last_hit_ = statistics_->getTickerCount(rocksdb::BLOCK_CACHE_HIT);
+        last_miss_ = statistics_->getTickerCount(rocksdb::BLOCK_CACHE_MISS);
+        latencies_.clear();
+        windows_.clear();
+        latencies_.reserve(expected_ops);
+        windows_.reserve(expected_ops / window_ops_ + 1);
+        steady_window_ = -1;
+
+        StopSampler();
+        pending_bytes_ = ReadPendingBytes();
+        sampling_ = true;
+        sampler_ = std::thread([this]() {
+            while (sampling_.load()) {
+                pending_bytes_ = ReadPendingBytes();
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+        });
+    }
+
+    // 연산 하나의 지연 시간 기록, 윈도우가 차면 윈도우 통계 계산
+    void Record(uint64_t latency_us) {
+        latencies_.push_back(latency_us);
+        if (latencies_.size() % window_ops_ == 0) CloseWindow();
+    }
+
+    bool Reached() const { return steady_window_ >= 0; }
+
+    void Report(const std::string& name) {
+        StopSampler();
+        std::cout << "\n[" << name << " steady state 분석]" << std::endl;
+        for (size_t i = 0; i < windows_.size(); ++i) {
+            const auto& w = windows_[i];
+            std::cout << "window " << i << " - " << w.end_sec << "초, " << w.throughput << " ops/s"
+                      << ", 평균 지연 " << w.mean_latency << "us"
+                      << ", hit율 " << w.hit_rate
+                      << ", pending " << w.pending_bytes << std::endl;
+        }
+
+        // 안정 구간 = steady state로 판정된 연속 윈도우의 시작부터 측정 끝까지
+        size_t first_window = 0;
+        if (Reached()) {
+            first_window = steady_window_ + 1 - steady_windows_;
+            const auto& w = windows_[steady_window_];
+            std::cout << "steady state 도달: window " << steady_window_ << " ("
+                      << w.end_sec << "초, " << w.end_index << "번째 연산), 안정 구간 시작 window "
+                      << first_window << std::endl;
+        } else {
+            std::cout << "steady state 미도달: 아래 지표는 전체 측정 구간 기준" << std::endl;
+        }
+
+        size_t begin_index = first_window == 0 ? 0 : windows_[first_window - 1].end_index;
+        double begin_sec = first_window == 0 ? 0.0 : windows_[first_window - 1].end_sec;
+        double end_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+        std::vector<uint64_t> stable(latencies_.begin() + begin_index, latencies_.end());
+
+        if (end_sec > begin_sec) {
+            std::cout << "안정 구간 처리량: " << stable.size() / (end_sec - begin_sec) << " ops/s" << std::endl;
+        }
+        printLatencySummary("안정 구간", stable);
+    }
+
+private:
+    struct Window {
+        double end_sec;
+        size_t end_index;
+        double throughput;
+        double mean_latency;
+        double hit_rate;       // 캐시 접근이 없으면 -1
+        uint64_t pending_bytes;
+    };
+
+    void CloseWindow() {
+        auto now = std::chrono::steady_clock::now();
+        double window_sec = std::chrono::duration<double>(now - window_start_).count();
+        window_start_ = now;
+
+        Window w;
+        w.end_sec = std::chrono::duration<double>(now - start_).count();
+        w.end_index = latencies_.size();
+        w.throughput = window_sec > 0 ? window_ops_ / window_sec : 0.0;
+
+        double sum = 0;
+        for (size_t i = latencies_.size() - window_ops_; i < latencies_.size(); ++i) sum += latencies_[i];
+        w.mean_latency = sum / window_ops_;
+
+        uint64_t hit = statistics_->getTickerCount(rocksdb::BLOCK_CACHE_HIT);
+        uint64_t miss = statistics_->getTickerCount(rocksdb::BLOCK_CACHE_MISS);
+        uint64_t accesses = (hit - last_hit_) + (miss - last_miss_);
+        w.hit_rate = accesses == 0 ? -1.0 : static_cast<double>(hit - last_hit_) / accesses;
+        last_hit_ = hit;
+        last_miss_ = miss;
+
+        w.pending_bytes = pending_bytes_.load();
+
+        windows_.push_back(w);
+        if (!Reached() && IsSteady()) steady_window_ = static_cast<int>(windows_.size()) - 1;
+    }
+
+    uint64_t ReadPendingBytes() const {
+        uint64_t total = 0;
+        for (auto* h : handles_) {
+            uint64_t v = 0;
+            if (db_->GetIntProperty(h, "rocksdb.estimate-pending-compaction-bytes", &v)) total += v;
+        }
+        return total;
+    }
+
+    void StopSampler() {
+        sampling_ = false;
+        if (sampler_.joinable()) sampler_.join();
+    }
+
+    // 최근 steady_windows_개 윈도우에서 field의 변동계수 (표준편차 / 평균)
+    double CoefficientOfVariation(double Window::*field) const {
+        size_t first = windows_.size() - steady_windows_;
+        double mean = 0;
+        for (size_t i = first; i < windows_.size(); ++i) mean += windows_[i].*field;
+        mean /= steady_windows_;
+        if (mean == 0) return 0;
+        double var = 0;
+        for (size_t i = first; i < windows_.size(); ++i) {
+            double d = windows_[i].*field - mean;
+            var += d * d;
+        }
+        return std::sqrt(var / steady_windows_) / mean;
+    }
+
+    bool IsSteady() const {
+        if (windows_.size() < steady_windows_) return false;
+        if (CoefficientOfVariation(&Window::throughput) > steady_cv_) return false;
+        if (CoefficientOfVariation(&Window::mean_latency) > steady_cv_) return false;
+        // 캐시 접근이 없던 윈도우(hit_rate < 0)는 hit율 비교에서 제외
+        double lo = 2.0, hi = -1.0;
+        for (size_t i = windows_.size() - steady_windows_; i < windows_.size(); ++i) {
+            double r = windows_[i].hit_rate;
+            if (r < 0) continue;
+            lo = std::min(lo, r);
+            hi = std::max(hi, r);
+        }
+        if (hi >= 0 && hi - lo > steady_hit_delta_) return false;
+        // compaction 부채가 계속 쌓이는 중이면 아직 안정 상태가 아님
+        uint64_t first_pending = windows_[windows_.size() - steady_windows_].pending_bytes;
+        uint64_t last_pending = windows_.back().pending_bytes;
+        if (last_pending > first_pending * (1 + steady_cv_) + (1 << 20)) return false;
+        return true;
+    }
+
+    std::shared_ptr<rocksdb::Statistics> statistics_;
+    rocksdb::DB* db_;
+    std::vector<rocksdb::ColumnFamilyHandle*> handles_;
+
+    uint64_t window_ops_;
+    size_t steady_windows_;
+    double steady_cv_;
+    double steady_hit_delta_;
+
+    std::chrono::steady_clock::time_point start_, window_start_;
+    uint64_t last_hit_ = 0, last_miss_ = 0;
+    std::vector<uint64_t> latencies_;
+    std::vector<Window> windows_;
+    int steady_window_ = -1;
+
+    std::atomic<uint64_t> pending_bytes_{0};
+    std::atomic<bool> sampling_{false};
+    std::thread sampler_;
+};
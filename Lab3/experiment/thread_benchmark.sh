@@ -0,0 +1,64 @@
+#!/bin/bash
+
+DB_PATH="./mydb"
+LOG_DIR="./exp_log_thread"
+NUM_KEYS=1000000
+HOT_START=0
+HOT_END=199999
+VALUE_SIZE=$((16 * 1024))  # 16KB
+HOT_RATIO=70
+
+mkdir -p "$LOG_DIR"
+
+# 실행 파일
+WRITE_EXEC="./rocksdb_benchmark"
+READ_EXEC="./rocksdb_read_benchmark"
+
+# 고정된 컴팩션 / 압축 방식
+HOT_COMPACTION="level"
+COLD_COMPACTION="universal"
+HOT_COMPRESSION="LZ4"
+COLD_COMPRESSION="ZSTD"
+
+# CPU 분할 구성: "이름|추가 옵션" (코어 수에 맞게 수정)
+declare -a THREAD_CONFIGS=(
+    "default|"
+    "jobs8|--max_background_jobs=8 --max_subcompactions=4"
+    "isolated|--max_background_jobs=8 --max_subcompactions=4 --fg_cpus=0-3 --bg_cpus=4-7"
+    "numa|--max_background_jobs=8 --max_subcompactions=4 --fg_numa=0 --bg_numa=1"
+)
+
+# 실험 반복 횟수
+NUM_RUNS=3
+
+for ((run=1; run<=NUM_RUNS; run++)); do
+    for CONFIG in "${THREAD_CONFIGS[@]}"; do
+        IFS='|' read -r CONFIG_NAME EXTRA_OPTS <<< "$CONFIG"
+
+        # NUMA 노드가 하나뿐인 호스트에서는 numa 구성을 건너뜀 (드라이버는 없는 노드를 지정하면 종료)
+        if [[ $CONFIG_NAME == numa && ! -e /sys/devices/system/node/node1 ]]; then
+            echo "NUMA node1이 없어 config=$CONFIG_NAME 건너뜀"
+            continue
+        fi
+
+        WRITE_LOG="$LOG_DIR/write_${CONFIG_NAME}_run${run}.log"
+        READ_LOG="$LOG_DIR/read_${CONFIG_NAME}_run${run}.log"
+
+        echo "실험 시작: config=$CONFIG_NAME (반복 $run)"
+
+        rm -rf "$DB_PATH"
+
+        "$WRITE_EXEC" "$DB_PATH" "$NUM_KEYS" "$HOT_START" "$HOT_END" "$VALUE_SIZE" "$HOT_RATIO" \
+            "$COLD_COMPACTION" "$HOT_COMPACTION" "$COLD_COMPRESSION" "$HOT_COMPRESSION" $EXTRA_OPTS \
+            > "$WRITE_LOG" 2>&1
+
+        "$READ_EXEC" "$DB_PATH" "$NUM_KEYS" "$HOT_START" "$HOT_END" "$VALUE_SIZE" "$HOT_RATIO" \
+            "$COLD_COMPACTION" "$HOT_COMPACTION" "$COLD_COMPRESSION" "$HOT_COMPRESSION" $EXTRA_OPTS \
+            > "$READ_LOG" 2>&1
+
+        echo "완료됨: $WRITE_LOG, $READ_LOG"
+        echo "-------------------------------"
+    done
+done
+
+echo "모든 실험 완료 ✅"
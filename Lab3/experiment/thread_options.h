@@ -0,0 +1,152 @@
+// 백그라운드 job / Env 스레드 풀 크기와 CPU 고정(affinity) 옵션 (Linux 전용)
+#pragma once
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include <pthread.h>
+#include <sched.h>
+#include <rocksdb/env.h>
+#include <rocksdb/options.h>
+#include "bench_options.h"
+
+// "0-3,8,10-11" 형식의 CPU 목록을 CPU 번호 집합으로 변환
+inline std::set<int> parseCpuList(const std::string& list) {
+    std::set<int> cpus;
+    for (const auto& part : splitList(list)) {
+        auto dash = part.find('-');
+        int first = std::stoi(part.substr(0, dash));
+        int last = (dash == std::string::npos) ? first : std::stoi(part.substr(dash + 1));
+        for (int c = first; c <= last; ++c) cpus.insert(c);
+    }
+    return cpus;
+}
+
+// NUMA 노드에 속한 CPU 목록 (sysfs)
+inline std::string readNumaCpuList(int node) {
+    std::ifstream in("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    std::string list;
+    std::getline(in, list);
+    return list;
+}
+
+// --<prefix>_cpus=0-3 또는 --<prefix>_numa=0 으로 지정한 CPU 집합 (없으면 빈 집합)
+inline std::set<int> getCpuSet(const ExtraOptions& opts, const std::string& prefix) {
+    std::string cpus = getOption(opts, prefix + "_cpus");
+    if (!cpus.empty()) return parseCpuList(cpus);
+    std::string numa = getOption(opts, prefix + "_numa");
+    if (!numa.empty()) {
+        std::set<int> result;
+        for (const auto& node : splitList(numa)) {
+            std::string list = readNumaCpuList(std::stoi(node));
+            if (list.empty()) {
+                // 없는 노드를 지정하면 고정 없이 실행되어 결과가 잘못 해석되므로 중단
+                std::cerr << "--" << prefix << "_numa: NUMA node" << node << "의 CPU 목록이 없습니다" << std::endl;
+                exit(1);
+            }
+            std::set<int> node_cpus = parseCpuList(list);
+            result.insert(node_cpus.begin(), node_cpus.end());
+        }
+        return result;
+    }
+    return {};
+}
+
+// 현재 스레드를 CPU 집합에 고정. 이후 이 스레드가 만드는 스레드는 같은 affinity를 상속한다
+inline void pinCurrentThread(const std::set<int>& cpus) {
+    if (cpus.empty()) return;
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (int c : cpus) CPU_SET(c, &mask);
+    int rc = pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask);
+    if (rc != 0) {
+        std::cerr << "CPU affinity 설정 실패 (errno " << rc << ")" << std::endl;
+        exit(1);
+    }
+}
+
+// 포그라운드 지정이 없을 때 되돌릴, 고정 전 메인 스레드 affinity
+inline cpu_set_t g_original_affinity;
+
+// 백그라운드 job 수, 서브 컴팩션 수, Env 스레드 풀 크기 및 CPU 고정 적용 (DB 오픈 전에 호출)
+// 호출 후 메인 스레드는 백그라운드 CPU에 고정된 상태이므로 DB 오픈 뒤 pinForegroundThread()를 호출할 것
+//   --max_background_jobs=8 --max_subcompactions=4
+//   --low_pool_threads=6 --high_pool_threads=2 --bottom_pool_threads=0
+//   --bg_cpus=8-15 | --bg_numa=1   (compaction/flush 스레드)
+//   --fg_cpus=0-7  | --fg_numa=0   (벤치마크 워커 스레드)
+inline void applyThreadOptions(rocksdb::Options& options, const ExtraOptions& opts) {
+    std::string v;
+    if (!(v = getOption(opts, "max_background_jobs")).empty())
+        options.max_background_jobs = std::stoi(v);
+    if (!(v = getOption(opts, "max_subcompactions")).empty())
+        options.max_subcompactions = static_cast<uint32_t>(std::stoul(v));
+
+    rocksdb::Env* env = options.env ? options.env : rocksdb::Env::Default();
+
+    // 스레드 풀의 스레드는 SetBackgroundThreads 호출 시 생성되므로,
+    // 잠시 메인 스레드를 백그라운드 CPU에 고정해 두고 풀을 만들면 affinity가 상속된다
+    pthread_getaffinity_np(pthread_self(), sizeof(g_original_affinity), &g_original_affinity);
+    pinCurrentThread(getCpuSet(opts, "bg"));
+
+    // 풀 크기 기본값은 DB::Open이 max_background_jobs로 늘리는 크기와 같게 맞춘다
+    // 지정한 크기가 더 작으면 DB::Open이 풀을 늘리며, 그 스레드도 백그라운드 affinity를 상속하도록
+    // 메인 스레드는 DB 오픈이 끝날 때까지 백그라운드 CPU에 둔다
+    int flushes = std::max(1, options.max_background_jobs / 4);
+    int compactions = std::max(1, options.max_background_jobs - flushes);
+    env->SetBackgroundThreads(
+        static_cast<int>(getOptionU64(opts, "low_pool_threads", compactions)), rocksdb::Env::LOW);
+    env->SetBackgroundThreads(
+        static_cast<int>(getOptionU64(opts, "high_pool_threads", flushes)), rocksdb::Env::HIGH);
+    if (!(v = getOption(opts, "bottom_pool_threads")).empty())
+        env->SetBackgroundThreads(std::stoi(v), rocksdb::Env::BOTTOM);
+}
+
+// DB 오픈 후 메인(및 이후 생성되는 워커) 스레드를 포그라운드 CPU로 이동
+inline void pinForegroundThread(const ExtraOptions& opts) {
+    std::set<int> fg = getCpuSet(opts, "fg");
+    if (fg.empty()) {
+        // 포그라운드 지정이 없으면 고정 전 상태로 복구
+        pthread_setaffinity_np(pthread_self(), sizeof(g_original_affinity), &g_original_affinity);
+    } else {
+        pinCurrentThread(fg);
+    }
+}
+
+inline std::string cpuSetToString(const std::set<int>& cpus) {
+    if (cpus.empty()) return "미지정";
+    std::string s;
+    for (int c : cpus) s += (s.empty() ? "" : ",") + std::to_string(c);
+    return s;
+}
+
+// 실험 결과 비교를 위해 사용한 CPU 토폴로지와 스레드 설정 기록
+inline void printCpuTopology(const rocksdb::Options& options, const ExtraOptions& opts) {
+    std::string model;
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    for (std::string line; std::getline(cpuinfo, line);) {
+        if (line.rfind("model name", 0) == 0) {
+            model = line.substr(line.find(':') + 2);
+            break;
+        }
+    }
+
+    rocksdb::Env* env = options.env ? options.env : rocksdb::Env::Default();
+    std::cout << "CPU 모델: " << model << std::endl;
+    std::cout << "논리 코어 수: " << std::thread::hardware_concurrency() << std::endl;
+    for (int node = 0;; ++node) {
+        std::string list = readNumaCpuList(node);
+        if (list.empty()) break;
+        std::cout << "NUMA node" << node << " CPU: " << list << std::endl;
+    }
+    std::cout << "포그라운드 CPU: " << cpuSetToString(getCpuSet(opts, "fg"))
+              << ", 백그라운드 CPU: " << cpuSetToString(getCpuSet(opts, "bg")) << std::endl;
+    std::cout << "max_background_jobs: " << options.max_background_jobs
+              << ", max_subcompactions: " << options.max_subcompactions
+              << ", LOW 풀: " << env->GetBackgroundThreads(rocksdb::Env::LOW)
+              << ", HIGH 풀: " << env->GetBackgroundThreads(rocksdb::Env::HIGH)
+              << ", BOTTOM 풀: " << env->GetBackgroundThreads(rocksdb::Env::BOTTOM) << std::endl;
+}
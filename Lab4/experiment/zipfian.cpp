@@ -6,6 +6,13 @@
 #include <rocksdb/metadata.h>
 #include <rocksdb/utilities/options_util.h>
 #include <rocksdb/utilities/db_ttl.h>
+#include <rocksdb/write_batch.h>
+
+// Lab3 하니스와 같은 옵션 파싱 / I/O 모드 / I/O 지표 / 힙 할당 측정 코드를 공유
+#include "../../Lab3/experiment/bench_options.h"
+#include "../../Lab3/experiment/io_options.h"
+#include "../../Lab3/experiment/io_stats.h"
+#include "../../Lab3/experiment/alloc_counter.h"
 
 #include <iostream>
 #include <thread>
@@ -14,6 +21,8 @@
 #include <map>
 #include <vector>
 #include <cmath>
+#include <algorithm>
+#include <cstdio>
 
 using namespace rocksdb;
 
@@ -70,8 +79,8 @@ class ZipfGenerator {
     std::discrete_distribution<int> distribution;
 
 public:
-    ZipfGenerator(int n, double alpha)
-        : generator(42)  // 시드 고정
+    ZipfGenerator(int n, double alpha, unsigned seed = 42)
+        : generator(seed)  // 시드 고정
     {
         std::vector<double> weights(n);
         for (int i = 0; i < n; ++i) {
@@ -85,21 +94,141 @@ public:
     }
 };
 
+// 🔌 RocksDB(PosixFileSystem)가 io_uring 사용 여부를 확인하는 weak 심볼
+// 심볼이 없던 기존 실행과 같도록 기본은 꺼 두고 async 모드에서만 켠다
+static bool g_io_uring_enabled = false;
+extern "C" bool RocksDbIOUringEnable() { return g_io_uring_enabled; }
+
+// 📖 Zipfian 읽기
+//   io_mode: sync           키마다 Get (pread 기준선, io_uring 꺼짐, queue_depth 무시)
+//            async          스레드마다 queue_depth개 키를 모아 async_io MultiGet (io_uring 켜짐)
+//            async_no_uring async와 같지만 io_uring 꺼짐
+void RunZipfReads(DB* db, const std::string& db_path, int num_keys, double alpha, int read_ops,
+                  const std::string& io_mode, int queue_depth, int read_threads) {
+    bool async = (io_mode != "sync");
+    if (!async) queue_depth = 1;
+
+    auto stats = db->GetOptions().statistics;
+    uint64_t sst_reads_before = sstReadCount(stats);
+    std::string device_stat_path = deviceStatPath(db_path);
+    DeviceStats dev_before, dev_after;
+    readDeviceStats(device_stat_path, &dev_before);
+    CacheIoSnapshot io_before = takeCacheIoSnapshot(stats);
+
+    std::vector<std::vector<uint64_t>> thread_lat(read_threads);
+    std::vector<uint64_t> thread_found(read_threads, 0);
+    int ops_per_thread = read_ops / read_threads;
+
+    std::cout << "\n[📖 Reading " << ops_per_thread * read_threads << " keys: mode=" << io_mode
+              << ", queue_depth=" << queue_depth << ", threads=" << read_threads
+              << ", io_uring=" << (g_io_uring_enabled ? "on" : "off") << "]\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < read_threads; ++t) {
+        workers.emplace_back([&, t]() {
+            ZipfGenerator zipf(num_keys, alpha, 1000 + t);
+            ReadOptions read_opts;
+            read_opts.async_io = async;
+            read_opts.optimize_multiget_for_io = async;
+
+            std::vector<char> key_bufs(queue_depth * 32);
+            std::vector<Slice> keys(queue_depth);
+            std::vector<PinnableSlice> values(queue_depth);
+            std::vector<Status> statuses(queue_depth);
+            auto& lat = thread_lat[t];
+            lat.reserve(ops_per_thread / queue_depth + 1);
+
+            if (!async) {
+                for (int i = 0; i < ops_per_thread; ++i) {
+                    Slice key(key_bufs.data(), snprintf(key_bufs.data(), 32, "key_%d", zipf.next()));
+                    values[0].Reset();
+                    auto t0 = std::chrono::steady_clock::now();
+                    Status st = db->Get(read_opts, db->DefaultColumnFamily(), key, &values[0]);
+                    auto t1 = std::chrono::steady_clock::now();
+                    lat.push_back(std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
+                    if (st.ok()) thread_found[t]++;
+                }
+                return;
+            }
+
+            for (int done = 0; done < ops_per_thread; done += queue_depth) {
+                int n = std::min(queue_depth, ops_per_thread - done);
+                for (int k = 0; k < n; ++k) {
+                    char* buf = &key_bufs[k * 32];
+                    keys[k] = Slice(buf, snprintf(buf, 32, "key_%d", zipf.next()));
+                }
+                auto t0 = std::chrono::steady_clock::now();
+                db->MultiGet(read_opts, db->DefaultColumnFamily(), n, keys.data(), values.data(), statuses.data());
+                auto t1 = std::chrono::steady_clock::now();
+                lat.push_back(std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
+                for (int k = 0; k < n; ++k) {
+                    if (statuses[k].ok()) thread_found[t]++;
+                    values[k].Reset();
+                }
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+    auto end = std::chrono::high_resolution_clock::now();
+    double elapsed = std::chrono::duration<double>(end - start).count();
+
+    std::vector<uint64_t> all_lat;
+    uint64_t found = 0;
+    for (int t = 0; t < read_threads; ++t) {
+        all_lat.insert(all_lat.end(), thread_lat[t].begin(), thread_lat[t].end());
+        found += thread_found[t];
+    }
+
+    std::cout << "⏱️ Total read time: " << elapsed << " seconds ("
+              << ops_per_thread * read_threads / elapsed << " ops/s, found " << found << ")\n";
+    printLatencySummary(async ? "MultiGet batch" : "Get", all_lat);
+    printAsyncMultiGetSupport(stats, async);
+    std::cout << "RocksDB SST read IOPS: " << (sstReadCount(stats) - sst_reads_before) / elapsed << "\n";
+    if (readDeviceStats(device_stat_path, &dev_after)) {
+        printDeviceStatsDelta("Read", dev_before, dev_after, elapsed);
+    }
+    printCacheIoBreakdown("Read", io_before, takeCacheIoSnapshot(stats));
+}
+
 int main(int argc, char** argv) {
-    if (argc < 8) {
-        std::cerr << "Usage: ./zipfdb <db_path> <num_keys> <value_size> <zipf_alpha> <preclude_sec> <preserve_sec> <temp>\n";
+    // 위치 인자 다음부터는 Lab3 하니스와 같은 --key=value 옵션
+    std::vector<std::string> pos;
+    int first_option = 1;
+    while (first_option < argc && std::string(argv[first_option]).rfind("--", 0) != 0) {
+        pos.push_back(argv[first_option++]);
+    }
+    if (pos.size() < 7) {
+        std::cerr << "Usage: ./zipfdb <db_path> <num_keys> <value_size> <zipf_alpha> <preclude_sec> <preserve_sec> <temp>"
+                  << " [read_ops] [io_mode(sync|async|async_no_uring)] [queue_depth] [read_threads]"
+                  << " [--key=value ...]\n"
+                  << "  I/O options (same as Lab3): --file_io=buffered|direct|mmap, --direct_reads,"
+                  << " --direct_io_for_flush_and_compaction, --mmap_reads, --mmap_writes,"
+                  << " --compaction_readahead_kb, --bytes_per_sync_kb, --wal_bytes_per_sync_kb,"
+                  << " --rate_limit_mb, --rate_limit_auto_tune, --check_alloc\n";
         return 1;
     }
+    ExtraOptions extra = parseExtraOptions(argc, argv, first_option);
 
     auto start_time = StartTimer();
 
-    std::string db_path = argv[1];
-    int num_keys = std::stoi(argv[2]);
-    int value_size = std::stoi(argv[3]);
-    double alpha = std::stod(argv[4]);
-    int preclude_sec = std::stoi(argv[5]);
-    int preserve_sec = std::stoi(argv[6]);
-    std::string temp_str = argv[7];
+    std::string db_path = pos[0];
+    int num_keys = std::stoi(pos[1]);
+    int value_size = std::stoi(pos[2]);
+    double alpha = std::stod(pos[3]);
+    int preclude_sec = std::stoi(pos[4]);
+    int preserve_sec = std::stoi(pos[5]);
+    std::string temp_str = pos[6];
+    int read_ops = pos.size() > 7 ? std::stoi(pos[7]) : 0;
+    std::string io_mode = pos.size() > 8 ? pos[8] : "sync";
+    if (io_mode != "sync" && io_mode != "async" && io_mode != "async_no_uring") {
+        std::cerr << "Unknown io_mode: " << io_mode << " (sync | async | async_no_uring)\n";
+        return 1;
+    }
+    // SST 파일은 쓰기 단계의 flush/compaction에서 열릴 때 io_uring 사용 여부가 정해지므로 DB 오픈 전에 설정
+    g_io_uring_enabled = (io_mode == "async");
+    int queue_depth = pos.size() > 9 ? std::max(1, std::stoi(pos[9])) : 1;
+    int read_threads = pos.size() > 10 ? std::max(1, std::stoi(pos[10])) : 1;
 
     Temperature temp = Temperature::kUnknown;
     if (temp_str == "hot") temp = Temperature::kHot;
@@ -116,6 +245,10 @@ int main(int argc, char** argv) {
     options.preclude_last_level_data_seconds = preclude_sec;
     options.preserve_internal_time_seconds = preserve_sec;
 
+    // 💽 파일 I/O 방식 (buffered / direct / mmap), readahead, bytes_per_sync, rate limiter
+    applyIoOptions(options, extra);
+    printIoOptions(options);
+
     DestroyDB(db_path, options);
 
     DB* db;
@@ -125,17 +258,31 @@ int main(int argc, char** argv) {
         return 1;
     }
 
+    // 쓰기 루프에서 힙 할당이 없도록 키 버퍼, 값, 옵션, WriteBatch를 재사용
     std::string value(value_size, 'Z');
+    Slice value_slice(value);
+    char key_buf[32];
+    WriteOptions write_opts;
+    WriteBatch batch(value_size + 64);
+    AllocStats write_allocs;
 
     ZipfGenerator zipf(num_keys, alpha);  // ZipfGenerator 생성
+    CacheIoSnapshot write_io_before = takeCacheIoSnapshot(stats);
 
     auto start = std::chrono::high_resolution_clock::now();  // 쓰기 시작 시간
 
     std::cout << "[💾 Writing " << num_keys << " keys...]\n";
     for (int i = 0; i < num_keys; ++i) {
+        uint64_t a0 = ThreadAllocCount();
         int key_id = zipf.next();  // 빠른 Zipfian key 생성
-        std::string key = "key_" + std::to_string(key_id);
-        db->Put(WriteOptions(), key, value);
+        int key_len = snprintf(key_buf, sizeof(key_buf), "key_%d", key_id);
+        batch.Clear();
+        batch.Put(Slice(key_buf, key_len), value_slice);
+        uint64_t a1 = ThreadAllocCount();
+        db->Write(write_opts, &batch);
+        write_allocs.harness += a1 - a0;
+        write_allocs.total += ThreadAllocCount() - a0;
+        write_allocs.ops++;
 
         if (i > 0 && i % 100000 == 0) {
             std::cout << "Inserted " << i << " keys\n";
@@ -145,9 +292,15 @@ int main(int argc, char** argv) {
     auto end = std::chrono::high_resolution_clock::now();  // 쓰기 종료 시간
     std::chrono::duration<double> elapsed = end - start;
     std::cout << "\n⏱️ Total write time: " << elapsed.count() << " seconds\n";
+    printAllocSummary("Write", write_allocs, getOptionBool(extra, "check_alloc", false));
+    printCacheIoBreakdown("Write", write_io_before, takeCacheIoSnapshot(stats));
     uint64_t db_size = get_directory_size(db_path);
     std::cout << "DB 디렉토리 사용량: " << db_size << " bytes (" << db_size / (1024.0 * 1024.0) << " MB)" << std::endl;
 
+    if (read_ops > 0) {
+        RunZipfReads(db, db_path, num_keys, alpha, read_ops, io_mode, queue_depth, read_threads);
+    }
+
 
     // std::cout << "\n⏳ Waiting 15 seconds for tiered storage temperature classification...\n";
     // std::this_thread::sleep_for(std::chrono::seconds(10));
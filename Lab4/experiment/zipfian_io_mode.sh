@@ -0,0 +1,32 @@
+#!/bin/bash
+
+# 파일 I/O 방식(buffered / direct / mmap)별 Zipfian 쓰기·읽기 비교
+# 페이지 캐시 압박을 주기 위해 메모리 상한이 있는 cgroup에서 실행
+EXEC=./zipfdb
+DB_PATH=./mydb
+NUM_KEYS=1000000
+VALUE_SIZE=16384
+ALPHA=0.9
+READ_OPS=200000
+READ_THREADS=4
+MEMORY_LIMIT=1G
+
+file_io_modes=(buffered direct mmap)
+IO_OPTS="--compaction_readahead_kb=2048 --bytes_per_sync_kb=1024 --wal_bytes_per_sync_kb=1024 --rate_limit_mb=200"
+
+mkdir -p exp_log
+
+for run in {1..3}; do
+    for file_io in "${file_io_modes[@]}"; do
+        echo "Running I/O mode test: run=$run, file_io=$file_io"
+        LOGFILE="exp_log/io_run${run}_alpha${ALPHA}_${file_io}.log"
+
+        rm -rf "$DB_PATH"
+
+        systemd-run --user --scope --quiet -p MemoryMax=$MEMORY_LIMIT \
+            $EXEC "$DB_PATH" "$NUM_KEYS" "$VALUE_SIZE" $ALPHA 0 0 cold \
+            $READ_OPS sync 1 $READ_THREADS --file_io=$file_io $IO_OPTS > "$LOGFILE" 2>&1
+    done
+done
+
+echo "🎉 All I/O mode experiments completed."
@@ -0,0 +1,35 @@
+#!/bin/bash
+
+# 동기 읽기 vs async_io(MultiGet) 읽기 비교: 큐 깊이별 IOPS / 디바이스 큐 깊이 / 지연 시간
+EXEC=./zipfdb
+DB_PATH=./mydb
+NUM_KEYS=1000000
+VALUE_SIZE=16384
+ALPHA=0.9
+READ_OPS=200000
+READ_THREADS=4
+
+# 모드 / 스레드당 큐 깊이 (sync는 키마다 Get = pread 기준선, 큐 깊이 무시)
+modes=(sync async async_no_uring)
+queue_depths=(1 4 16 32)
+
+mkdir -p exp_log
+
+for run in {1..3}; do
+    for mode in "${modes[@]}"; do
+        for qd in "${queue_depths[@]}"; do
+            if [[ $mode == sync && $qd != 1 ]]; then
+                continue
+            fi
+            echo "Running read test: run=$run, mode=$mode, queue_depth=$qd"
+            LOGFILE="exp_log/read_run${run}_alpha${ALPHA}_${mode}_qd${qd}.log"
+
+            rm -rf "$DB_PATH"
+
+            $EXEC "$DB_PATH" "$NUM_KEYS" "$VALUE_SIZE" $ALPHA 0 0 cold \
+                $READ_OPS $mode $qd $READ_THREADS > "$LOGFILE" 2>&1
+        done
+    done
+done
+
+echo "🎉 All read experiments completed."